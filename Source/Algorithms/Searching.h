@@ -0,0 +1,386 @@
+/*
+	FILE: Searching.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: A collection of templated linear searching algorithms. Arrays of arithmetic types are searched with
+		SSE2 or AVX2 instructions when the CPU supports them, comparing 16 or 32 bytes of items at a time. All other
+		types are searched one item at a time with operator==.
+*/
+
+#pragma once
+
+#include <assert.h>
+#include <type_traits> // Used to find arithmetic types, which can be compared with SIMD instructions.
+
+#include "Simd.h"
+
+/*
+	INSIGHT: Every SIMD search compares a register of items to a register filled with the value, then gathers the
+		top bit of every byte of the result into a mask with movemask. An item that matched sets sizeof(Type) bits in
+		the mask, so the index of the lowest set bit divided by sizeof(Type) is the index of the first match, and the
+		number of set bits divided by sizeof(Type) is the number of matches. Floating point items are compared with
+		floating point instructions, so 0.0 matches -0.0 and NaN matches nothing, the same as operator==.
+*/
+
+namespace Search
+{
+	/*
+		DESCRIPTION: Whether arrays of a type can be searched with SIMD instructions.
+	*/
+	template<typename Type>
+	using IsVectorizable = std::integral_constant<bool, std::is_arithmetic<Type>::value &&
+		(sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8)>;
+
+	/*
+		DESCRIPTION: Returns the index of the first item equal to the value, comparing one item at a time.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to find.
+		RETURNS: unsigned int - The index of the first match, or _arraySize if there is no match.
+	*/
+	template<typename Type>
+	unsigned int ScalarIndexOf(const Type* _array, unsigned int _arraySize, const Type& _value)
+	{
+		for (unsigned int i = 0; i < _arraySize; ++i)
+			if (_array[i] == _value)
+				return i;
+
+		return _arraySize;
+	}
+
+	/*
+		DESCRIPTION: Returns the number of items equal to the value, comparing one item at a time.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to count.
+		RETURNS: unsigned int - The number of matches.
+	*/
+	template<typename Type>
+	unsigned int ScalarCount(const Type* _array, unsigned int _arraySize, const Type& _value)
+	{
+		unsigned int count = 0;
+
+		for (unsigned int i = 0; i < _arraySize; ++i)
+			if (_array[i] == _value)
+				++count;
+
+		return count;
+	}
+
+#if defined(SIMD_X86)
+	/*
+		DESCRIPTION: Fills a 128-bit register with a value and compares registers of items, for each kind of
+			arithmetic type. Matching items are set to all ones.
+	*/
+	template<typename Type, unsigned int Size = sizeof(Type), bool IsFloat = std::is_floating_point<Type>::value>
+	struct Sse2Lanes;
+
+	template<typename Type>
+	struct Sse2Lanes<Type, 1, false>
+	{
+		static SIMD_TARGET_SSE2 inline __m128i Fill(const Type& _value) { return _mm_set1_epi8(static_cast<char>(_value)); }
+		static SIMD_TARGET_SSE2 inline __m128i Equal(__m128i _a, __m128i _b) { return _mm_cmpeq_epi8(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Sse2Lanes<Type, 2, false>
+	{
+		static SIMD_TARGET_SSE2 inline __m128i Fill(const Type& _value) { return _mm_set1_epi16(static_cast<short>(_value)); }
+		static SIMD_TARGET_SSE2 inline __m128i Equal(__m128i _a, __m128i _b) { return _mm_cmpeq_epi16(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Sse2Lanes<Type, 4, false>
+	{
+		static SIMD_TARGET_SSE2 inline __m128i Fill(const Type& _value) { return _mm_set1_epi32(static_cast<int>(_value)); }
+		static SIMD_TARGET_SSE2 inline __m128i Equal(__m128i _a, __m128i _b) { return _mm_cmpeq_epi32(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Sse2Lanes<Type, 8, false>
+	{
+		static SIMD_TARGET_SSE2 inline __m128i Fill(const Type& _value) { return _mm_set1_epi64x(static_cast<long long>(_value)); }
+
+		// SSE2 has no 64-bit compare, so both 32-bit halves of an item must match.
+		static SIMD_TARGET_SSE2 inline __m128i Equal(__m128i _a, __m128i _b)
+		{
+			__m128i equal = _mm_cmpeq_epi32(_a, _b);
+			return _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+		}
+	};
+
+	template<typename Type>
+	struct Sse2Lanes<Type, 4, true>
+	{
+		static SIMD_TARGET_SSE2 inline __m128i Fill(const Type& _value) { return _mm_castps_si128(_mm_set1_ps(static_cast<float>(_value))); }
+		static SIMD_TARGET_SSE2 inline __m128i Equal(__m128i _a, __m128i _b) { return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(_a), _mm_castsi128_ps(_b))); }
+	};
+
+	template<typename Type>
+	struct Sse2Lanes<Type, 8, true>
+	{
+		static SIMD_TARGET_SSE2 inline __m128i Fill(const Type& _value) { return _mm_castpd_si128(_mm_set1_pd(static_cast<double>(_value))); }
+		static SIMD_TARGET_SSE2 inline __m128i Equal(__m128i _a, __m128i _b) { return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(_a), _mm_castsi128_pd(_b))); }
+	};
+
+	/*
+		DESCRIPTION: Fills a 256-bit register with a value and compares registers of items, for each kind of
+			arithmetic type. Matching items are set to all ones.
+	*/
+	template<typename Type, unsigned int Size = sizeof(Type), bool IsFloat = std::is_floating_point<Type>::value>
+	struct Avx2Lanes;
+
+	template<typename Type>
+	struct Avx2Lanes<Type, 1, false>
+	{
+		static SIMD_TARGET_AVX2 inline __m256i Fill(const Type& _value) { return _mm256_set1_epi8(static_cast<char>(_value)); }
+		static SIMD_TARGET_AVX2 inline __m256i Equal(__m256i _a, __m256i _b) { return _mm256_cmpeq_epi8(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Avx2Lanes<Type, 2, false>
+	{
+		static SIMD_TARGET_AVX2 inline __m256i Fill(const Type& _value) { return _mm256_set1_epi16(static_cast<short>(_value)); }
+		static SIMD_TARGET_AVX2 inline __m256i Equal(__m256i _a, __m256i _b) { return _mm256_cmpeq_epi16(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Avx2Lanes<Type, 4, false>
+	{
+		static SIMD_TARGET_AVX2 inline __m256i Fill(const Type& _value) { return _mm256_set1_epi32(static_cast<int>(_value)); }
+		static SIMD_TARGET_AVX2 inline __m256i Equal(__m256i _a, __m256i _b) { return _mm256_cmpeq_epi32(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Avx2Lanes<Type, 8, false>
+	{
+		static SIMD_TARGET_AVX2 inline __m256i Fill(const Type& _value) { return _mm256_set1_epi64x(static_cast<long long>(_value)); }
+		static SIMD_TARGET_AVX2 inline __m256i Equal(__m256i _a, __m256i _b) { return _mm256_cmpeq_epi64(_a, _b); }
+	};
+
+	template<typename Type>
+	struct Avx2Lanes<Type, 4, true>
+	{
+		static SIMD_TARGET_AVX2 inline __m256i Fill(const Type& _value) { return _mm256_castps_si256(_mm256_set1_ps(static_cast<float>(_value))); }
+		static SIMD_TARGET_AVX2 inline __m256i Equal(__m256i _a, __m256i _b) { return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(_a), _mm256_castsi256_ps(_b), _CMP_EQ_OQ)); }
+	};
+
+	template<typename Type>
+	struct Avx2Lanes<Type, 8, true>
+	{
+		static SIMD_TARGET_AVX2 inline __m256i Fill(const Type& _value) { return _mm256_castpd_si256(_mm256_set1_pd(static_cast<double>(_value))); }
+		static SIMD_TARGET_AVX2 inline __m256i Equal(__m256i _a, __m256i _b) { return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(_a), _mm256_castsi256_pd(_b), _CMP_EQ_OQ)); }
+	};
+
+	/*
+		DESCRIPTION: Returns the index of the first item equal to the value, comparing 16 bytes of items at a time.
+			The CPU must support SSE2.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to find.
+		RETURNS: unsigned int - The index of the first match, or _arraySize if there is no match.
+	*/
+	template<typename Type>
+	SIMD_TARGET_SSE2 unsigned int Sse2IndexOf(const Type* _array, unsigned int _arraySize, const Type& _value)
+	{
+		constexpr unsigned int LANE_COUNT = 16 / sizeof(Type);
+
+		const __m128i value = Sse2Lanes<Type>::Fill(_value);
+		unsigned int i = 0;
+
+		for (; i + LANE_COUNT <= _arraySize; i += LANE_COUNT)
+		{
+			__m128i items = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_array + i));
+			unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(Sse2Lanes<Type>::Equal(items, value)));
+
+			if (mask)
+				return i + Simd::LowestBit(mask) / sizeof(Type);
+		}
+
+		return i + ScalarIndexOf(_array + i, _arraySize - i, _value);
+	}
+
+	/*
+		DESCRIPTION: Returns the number of items equal to the value, comparing 16 bytes of items at a time. The CPU
+			must support SSE2.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to count.
+		RETURNS: unsigned int - The number of matches.
+	*/
+	template<typename Type>
+	SIMD_TARGET_SSE2 unsigned int Sse2Count(const Type* _array, unsigned int _arraySize, const Type& _value)
+	{
+		constexpr unsigned int LANE_COUNT = 16 / sizeof(Type);
+
+		const __m128i value = Sse2Lanes<Type>::Fill(_value);
+		unsigned int count = 0;
+		unsigned int i = 0;
+
+		for (; i + LANE_COUNT <= _arraySize; i += LANE_COUNT)
+		{
+			__m128i items = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_array + i));
+			count += Simd::CountBits(static_cast<unsigned int>(_mm_movemask_epi8(Sse2Lanes<Type>::Equal(items, value)))) / sizeof(Type);
+		}
+
+		return count + ScalarCount(_array + i, _arraySize - i, _value);
+	}
+
+	/*
+		DESCRIPTION: Returns the index of the first item equal to the value, comparing 32 bytes of items at a time.
+			The CPU must support AVX2.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to find.
+		RETURNS: unsigned int - The index of the first match, or _arraySize if there is no match.
+	*/
+	template<typename Type>
+	SIMD_TARGET_AVX2 unsigned int Avx2IndexOf(const Type* _array, unsigned int _arraySize, const Type& _value)
+	{
+		constexpr unsigned int LANE_COUNT = 32 / sizeof(Type);
+
+		const __m256i value = Avx2Lanes<Type>::Fill(_value);
+		unsigned int i = 0;
+
+		for (; i + LANE_COUNT <= _arraySize; i += LANE_COUNT)
+		{
+			__m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_array + i));
+			unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(Avx2Lanes<Type>::Equal(items, value)));
+
+			if (mask)
+				return i + Simd::LowestBit(mask) / sizeof(Type);
+		}
+
+		return i + ScalarIndexOf(_array + i, _arraySize - i, _value);
+	}
+
+	/*
+		DESCRIPTION: Returns the number of items equal to the value, comparing 32 bytes of items at a time. The CPU
+			must support AVX2.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to count.
+		RETURNS: unsigned int - The number of matches.
+	*/
+	template<typename Type>
+	SIMD_TARGET_AVX2 unsigned int Avx2Count(const Type* _array, unsigned int _arraySize, const Type& _value)
+	{
+		constexpr unsigned int LANE_COUNT = 32 / sizeof(Type);
+
+		const __m256i value = Avx2Lanes<Type>::Fill(_value);
+		unsigned int count = 0;
+		unsigned int i = 0;
+
+		for (; i + LANE_COUNT <= _arraySize; i += LANE_COUNT)
+		{
+			__m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_array + i));
+			count += Simd::CountBits(static_cast<unsigned int>(_mm256_movemask_epi8(Avx2Lanes<Type>::Equal(items, value)))) / sizeof(Type);
+		}
+
+		return count + ScalarCount(_array + i, _arraySize - i, _value);
+	}
+#endif
+
+	/*
+		DESCRIPTION: Returns the index of the first item equal to the value. Arithmetic items are compared with the
+			widest SIMD instructions allowed.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to find.
+			Simd::Level _level, the widest SIMD instructions to use. Must be supported by the CPU.
+		RETURNS: unsigned int - The index of the first match, or _arraySize if there is no match.
+	*/
+	template<typename Type>
+	unsigned int IndexOf(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level, std::false_type)
+	{
+		return ScalarIndexOf(_array, _arraySize, _value);
+	}
+
+	template<typename Type>
+	unsigned int IndexOf(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level _level, std::true_type)
+	{
+#if defined(SIMD_X86)
+		if (_level == Simd::Level::AVX2)
+			return Avx2IndexOf(_array, _arraySize, _value);
+
+		if (_level == Simd::Level::SSE2)
+			return Sse2IndexOf(_array, _arraySize, _value);
+#else
+		(void)_level; // Only x86 CPUs have SIMD versions to choose.
+#endif
+
+		return ScalarIndexOf(_array, _arraySize, _value);
+	}
+
+	template<typename Type>
+	unsigned int IndexOf(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level _level = Simd::SupportedLevel())
+	{
+		assert(_level <= Simd::SupportedLevel());
+
+		return IndexOf(_array, _arraySize, _value, _level, IsVectorizable<Type>());
+	}
+
+	/*
+		DESCRIPTION: Returns the number of items equal to the value. Arithmetic items are compared with the widest
+			SIMD instructions allowed.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to count.
+			Simd::Level _level, the widest SIMD instructions to use. Must be supported by the CPU.
+		RETURNS: unsigned int - The number of matches.
+	*/
+	template<typename Type>
+	unsigned int Count(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level, std::false_type)
+	{
+		return ScalarCount(_array, _arraySize, _value);
+	}
+
+	template<typename Type>
+	unsigned int Count(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level _level, std::true_type)
+	{
+#if defined(SIMD_X86)
+		if (_level == Simd::Level::AVX2)
+			return Avx2Count(_array, _arraySize, _value);
+
+		if (_level == Simd::Level::SSE2)
+			return Sse2Count(_array, _arraySize, _value);
+#else
+		(void)_level; // Only x86 CPUs have SIMD versions to choose.
+#endif
+
+		return ScalarCount(_array, _arraySize, _value);
+	}
+
+	template<typename Type>
+	unsigned int Count(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level _level = Simd::SupportedLevel())
+	{
+		assert(_level <= Simd::SupportedLevel());
+
+		return Count(_array, _arraySize, _value, _level, IsVectorizable<Type>());
+	}
+
+	/*
+		DESCRIPTION: Returns if an item equal to the value is in the array. Arithmetic items are compared with the
+			widest SIMD instructions allowed.
+		PARAMETERS:
+			const Type* _array, the array to search.
+			unsigned int _arraySize, the number of items in the array.
+			const Type& _value, the value to find.
+			Simd::Level _level, the widest SIMD instructions to use. Must be supported by the CPU.
+		RETURNS: bool - If the value is in the array.
+	*/
+	template<typename Type>
+	bool Contains(const Type* _array, unsigned int _arraySize, const Type& _value, Simd::Level _level = Simd::SupportedLevel())
+	{
+		return IndexOf(_array, _arraySize, _value, _level) < _arraySize;
+	}
+}
@@ -0,0 +1,122 @@
+/*
+	FILE: Simd.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Detects which SIMD instruction sets the CPU supports, so that algorithms can pick the widest
+		instructions available at runtime. The program is not compiled for any particular instruction set, instead
+		functions that use one are marked with SIMD_TARGET_SSE2 or SIMD_TARGET_AVX2 and are only called when
+		SupportedLevel() reports that the CPU has it. On CPUs other than x86, only the scalar level is supported.
+*/
+
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define SIMD_X86
+
+	#include <immintrin.h> // Used for the SSE2 and AVX2 intrinsics.
+
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h> // Used for __cpuid, _xgetbv, and _BitScanForward.
+	#endif
+#endif
+
+// GCC and Clang only compile intrinsics in functions that are marked with the instruction set they use.
+#if defined(__GNUC__) || defined(__clang__)
+	#define SIMD_TARGET_SSE2 __attribute__((target("sse2")))
+	#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define SIMD_TARGET_SSE2
+	#define SIMD_TARGET_AVX2
+#endif
+
+namespace Simd
+{
+	/*
+		DESCRIPTION: The SIMD instruction sets, from narrowest to widest.
+	*/
+	enum class Level
+	{
+		Scalar, // No SIMD instructions.
+		SSE2, // 128-bit registers.
+		AVX2 // 256-bit registers.
+	};
+
+	/*
+		DESCRIPTION: Asks the CPU, and the operating system, which SIMD instruction sets can be used.
+		RETURNS: Level - The widest instruction set supported.
+	*/
+	inline Level DetectLevel()
+	{
+#if defined(SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 0);
+		const int maxLeaf = info[0];
+
+		__cpuid(info, 1);
+		const bool sse2 = (info[3] & (1 << 26)) != 0;
+		const bool osSavesRegisters = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+
+		// AVX2 also needs the operating system to save the 256-bit registers.
+		if (maxLeaf >= 7 && osSavesRegisters && avx && (_xgetbv(0) & 6) == 6)
+		{
+			__cpuidex(info, 7, 0);
+			if (info[1] & (1 << 5))
+				return Level::AVX2;
+		}
+
+		return sse2 ? Level::SSE2 : Level::Scalar;
+#elif defined(SIMD_X86)
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+			return Level::AVX2;
+
+		return __builtin_cpu_supports("sse2") ? Level::SSE2 : Level::Scalar;
+#else
+		return Level::Scalar;
+#endif
+	}
+
+	/*
+		DESCRIPTION: Returns the widest SIMD instruction set that can be used. The CPU is only asked once.
+		RETURNS: Level - The widest instruction set supported.
+	*/
+	inline Level SupportedLevel()
+	{
+		static const Level level = DetectLevel();
+		return level;
+	}
+
+	/*
+		DESCRIPTION: Returns the index of the lowest set bit.
+		PARAMETERS:
+			unsigned int _bits, the bits to search. Must not be zero.
+		RETURNS: unsigned int - The index of the lowest set bit.
+	*/
+	inline unsigned int LowestBit(unsigned int _bits)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward(&index, _bits);
+		return index;
+#else
+		return __builtin_ctz(_bits);
+#endif
+	}
+
+	/*
+		DESCRIPTION: Returns the number of set bits.
+		PARAMETERS:
+			unsigned int _bits, the bits to count.
+		RETURNS: unsigned int - The number of set bits.
+	*/
+	inline unsigned int CountBits(unsigned int _bits)
+	{
+		// Sum the bits in pairs, then in nibbles, then add up the bytes with a multiply.
+		_bits = _bits - ((_bits >> 1) & 0x55555555u);
+		_bits = (_bits & 0x33333333u) + ((_bits >> 2) & 0x33333333u);
+		return (((_bits + (_bits >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+	}
+}
@@ -2,19 +2,69 @@
 	FILE: Sorting.h
 	AUTHOR: Ozzie Mercado
 	CREATED: February 3, 2021
-	MODIFIED: February 4, 2021
-	DESCRIPTION: A collection of various templated sorting algrorithms.
+	MODIFIED: October 16, 2026
+	DESCRIPTION: A collection of various templated sorting algrorithms. The algorithms and their costs are:
+		- BubbleSort(): O(N^2), O(N) if the array is already sorted.
+		- InsertionSort(): O(N^2), O(N) if the array is already sorted. The fastest for small arrays. Stable.
+		- BinaryInsertionSort(): O(N^2) moves but only O(N log N) comparisons, for costly comparison functions. Stable.
+		- HeapSort(): O(N log N) worst case, without any extra memory. Not stable.
+		- MergeSort(): O(N log N) worst case. Stable, meaning equal items keep their order. Uses a buffer of N/2 items.
+		- QuickSort(): O(N log N) worst case. The fastest in general. Not stable.
+		- ParallelSort(): O(N log N) work, split across threads. Sorts a part of the array on each thread, then merges 
+			the parts. Uses a buffer of N items. Not stable.
+		- NetworkSort(): Sorts up to 64 integers or floating point numbers with a fixed network of comparisons, 
+			running 4 or 8 of them at a time with AVX2 instructions when the CPU supports them. Used by QuickSort() to 
+			finish small parts of arrays sorted in ascending order.
+		- RadixSort(): O(N) for arithmetic keys, without comparing items. Sorts by one byte of the key at a time. 
+			Stable. Uses a buffer of N items.
 */
 
 #pragma once
 
 #include <assert.h>
-#include <functional> // Used for comparison functions.
+#include <cstdint> // Used for the unsigned integers that floating point keys are mapped to.
+#include <cstring> // Used for std::memcpy, which reads the bits of floating point keys.
+#include <functional> // Used for the default comparison functions, std::greater and std::less.
+#include <limits> // Used for the highest value of a type, which pads the networks of NetworkSort().
+#include <new> // Used for placement new, which moves items into the uninitialized buffers of the sorts.
+#include <thread> // Used for std::thread, which ParallelSort() splits the work across.
+#include <type_traits> // Used to map the keys of RadixSort() to unsigned integers.
+#include <utility> // Used for std::move and std::swap.
+
+#include "Simd.h"
+
+/*
+	INSIGHT: NetworkSort() runs a bitonic sorting network. Instead of comparing items one pair at a time, a register 
+		of items is compared with a register of other items, keeping the minimum of each pair in one register and the 
+		maximum in the other. Which items are paired never depends on the items, so there are no branches to 
+		mispredict. Each register is sorted by comparing it with copies of itself that have the items shuffled, then 
+		sorted registers are merged in pairs: reversing the second register makes the pair rise then fall, and a run 
+		like that is sorted by comparing items half the run apart, then a quarter, and so on down to neighbors.
+*/
+
+/*
+	INSIGHT: The comparison function is a template parameter instead of a std::function, so that the compiler can
+		inline it into the inner loops. Lambdas, functors, and std::function objects can all still be passed in.
+		The comparison function returns true when the first item belongs after the second item, so the default
+		comparison function, std::greater, sorts in ascending order.
+*/
 
 namespace Sort
 {
+	// Arrays this small are sorted with InsertionSort() by the O(N log N) sorts, since it is faster for so few items.
+	constexpr unsigned int SMALL_SORT_SIZE = 16;
+
+	// ParallelSort() gives each thread at least this many items, since starting a thread costs about as much as sorting them.
+	constexpr unsigned int PARALLEL_SORT_THRESHOLD = 1 << 16;
+
+	// RadixSort() sorts arrays smaller than this with InsertionSort(), since counting the bytes costs more than sorting them.
+	constexpr unsigned int RADIX_SORT_THRESHOLD = 64;
+
+	// The most items NetworkSort() can sort.
+	constexpr unsigned int NETWORK_SORT_SIZE = 64;
+
 	/*
-		DESCRIPTION: Swaps item A with item B.
+		DESCRIPTION: Swaps item A with item B. The items are moved, so types that own memory swap it instead of copying it.
 		PARAMETERS:
 			Type& _a, item A.
 			Type& _b, item B.
@@ -22,9 +72,57 @@ namespace Sort
 	template<typename Type>
 	inline void Swap(Type& _a, Type& _b)
 	{
-		Type temp = _a;
-		_a = _b;
-		_b = temp;
+		Type temp = std::move(_a);
+		_a = std::move(_b);
+		_b = std::move(temp);
+	}
+
+	/*
+		DESCRIPTION: Allocates a buffer for a sort to move items aside into. The items aren't constructed, so Type 
+			doesn't need a default constructor, and no time is spent constructing items that are about to be replaced.
+		PARAMETERS:
+			unsigned int _count, the number of items the buffer can hold.
+		RETURNS: Type* - The uninitialized buffer. Free it with FreeBuffer().
+	*/
+	template<typename Type>
+	inline Type* AllocateBuffer(unsigned int _count)
+	{
+		return static_cast<Type*>(::operator new(sizeof(Type) * static_cast<size_t>(_count)));
+	}
+
+	/*
+		DESCRIPTION: Destroys the items constructed in a buffer from AllocateBuffer() and frees it.
+		PARAMETERS:
+			Type* _buffer, the buffer.
+			unsigned int _constructedCount, the number of items constructed at the start of the buffer.
+	*/
+	template<typename Type>
+	inline void FreeBuffer(Type* _buffer, unsigned int _constructedCount)
+	{
+		for (unsigned int i = 0; i < _constructedCount; ++i)
+			_buffer[i].~Type();
+
+		::operator delete(_buffer);
+	}
+
+	/*
+		DESCRIPTION: Moves an item into a place, constructing it there if the place is uninitialized, or assigning 
+			it otherwise.
+		PARAMETERS:
+			Type* _place, where to move the item.
+			Type& _item, the item to move.
+			std::true_type if the place is uninitialized, or std::false_type if it holds an item.
+	*/
+	template<typename Type>
+	inline void MoveInto(Type* _place, Type& _item, std::true_type)
+	{
+		new (_place) Type(std::move(_item));
+	}
+
+	template<typename Type>
+	inline void MoveInto(Type* _place, Type& _item, std::false_type)
+	{
+		*_place = std::move(_item);
 	}
 
 	/*
@@ -32,10 +130,10 @@ namespace Sort
 		PARAMETERS:
 			Type* _array, the array to sort.
 			unsigned int _arraySize, the number of items in the array.
-			std::function<bool(const Type&, const Type&)> _comparisionFunc, function to determine order.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
 	*/
-	template<typename Type>
-	void BubbleSort(Type* _array, unsigned int _arraySize, std::function<bool(const Type&, const Type&)> _comparisionFunc)
+	template<typename Type, typename Compare = std::greater<Type>>
+	void BubbleSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare())
 	{
 		for (unsigned int i = 0; i < _arraySize - 1; ++i)
 		{
@@ -62,7 +160,7 @@ namespace Sort
 	template<typename Type>
 	void BubbleSortAscending(Type* _array, unsigned int _arraySize)
 	{
-		BubbleSort<Type>(_array, _arraySize, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+		BubbleSort(_array, _arraySize, std::greater<Type>());
 	}
 
 	/*
@@ -74,25 +172,37 @@ namespace Sort
 	template<typename Type>
 	void BubbleSortDescending(Type* _array, unsigned int _arraySize)
 	{
-		BubbleSort<Type>(_array, _arraySize, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+		BubbleSort(_array, _arraySize, std::less<Type>());
 	}
 
 	/*
-		DESCRIPTION: Sorts the array by visiting each item and sorting them amongst the other visited items.
+		DESCRIPTION: Sorts the array by visiting each item and sorting them amongst the other visited items. The item 
+			is moved out of the array, the items that belong after it are each moved up one place, and then it is moved 
+			into the gap. That is one move per place instead of the three of a swap.
 		PARAMETERS:
 			Type* _array, the array to sort.
 			unsigned int _arraySize, the number of items in the array.
-			std::function<bool(const Type&, const Type&)> _comparisionFunc, function to determine order.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
 	*/
-	template<typename Type>
-	void InsertionSort(Type* _array, unsigned int _arraySize, std::function<bool(const Type&, const Type&)> _comparisionFunc)
+	template<typename Type, typename Compare = std::greater<Type>>
+	void InsertionSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare())
 	{
 		for (unsigned int i = 1; i < _arraySize; ++i)
 		{
-			Type key = _array[i];
+			// Items already in place don't need to be moved out and back.
+			if (!_comparisionFunc(_array[i - 1], _array[i]))
+				continue;
+
+			Type key = std::move(_array[i]);
+			unsigned int j = i;
 
-			for (unsigned int j = i; j > 0 && _comparisionFunc(_array[j - 1], key); --j)
-				Swap<Type>(_array[j - 1], _array[j]);
+			do
+			{
+				_array[j] = std::move(_array[j - 1]);
+				--j;
+			} while (j > 0 && _comparisionFunc(_array[j - 1], key));
+
+			_array[j] = std::move(key);
 		}
 	}
 
@@ -105,7 +215,7 @@ namespace Sort
 	template<typename Type>
 	void InsertionSortAscending(Type* _array, unsigned int _arraySize)
 	{
-		InsertionSort<Type>(_array, _arraySize, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+		InsertionSort(_array, _arraySize, std::greater<Type>());
 	}
 
 	/*
@@ -117,6 +227,1267 @@ namespace Sort
 	template<typename Type>
 	void InsertionSortDescending(Type* _array, unsigned int _arraySize)
 	{
-		InsertionSort<Type>(_array, _arraySize, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+		InsertionSort(_array, _arraySize, std::less<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array like InsertionSort(), but finds where each item goes with a binary search of the 
+			visited items. Each item takes O(log N) comparisons instead of O(N), which is worth it when comparing items 
+			costs more than moving them. Items are placed after any equal items, so the sort is stable.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare = std::greater<Type>>
+	void BinaryInsertionSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare())
+	{
+		for (unsigned int i = 1; i < _arraySize; ++i)
+		{
+			if (!_comparisionFunc(_array[i - 1], _array[i]))
+				continue;
+
+			// The previous item belongs after this one, so only the items before it need to be searched.
+			unsigned int low = 0;
+			unsigned int high = i - 1;
+
+			while (low < high)
+			{
+				const unsigned int middle = low + (high - low) / 2;
+
+				if (_comparisionFunc(_array[middle], _array[i]))
+					high = middle;
+				else
+					low = middle + 1;
+			}
+
+			Type key = std::move(_array[i]);
+
+			for (unsigned int j = i; j > low; --j)
+				_array[j] = std::move(_array[j - 1]);
+
+			_array[low] = std::move(key);
+		}
+	}
+
+	/*
+		DESCRIPTION: Sorts the array like InsertionSort() in ascending order, finding where each item goes with a binary search.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void BinaryInsertionSortAscending(Type* _array, unsigned int _arraySize)
+	{
+		BinaryInsertionSort(_array, _arraySize, std::greater<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array like InsertionSort() in descending order, finding where each item goes with a binary search.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void BinaryInsertionSortDescending(Type* _array, unsigned int _arraySize)
+	{
+		BinaryInsertionSort(_array, _arraySize, std::less<Type>());
+	}
+
+	/*
+		DESCRIPTION: Helper function for HeapSort(). Moves an item down the heap until neither of its children belongs 
+			after it. The item is held aside while the children are moved up, instead of being swapped at each level.
+		PARAMETERS:
+			Type* _array, the heap.
+			unsigned int _index, the index of the item to move down.
+			unsigned int _heapSize, the number of items in the heap.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare>
+	void SiftDown(Type* _array, unsigned int _index, unsigned int _heapSize, Compare _comparisionFunc)
+	{
+		Type item = std::move(_array[_index]);
+
+		// The children of an item are at 2i + 1 and 2i + 2.
+		for (unsigned int child = 2 * _index + 1; child < _heapSize; child = 2 * _index + 1)
+		{
+			// Follow the child that belongs last.
+			if (child + 1 < _heapSize && _comparisionFunc(_array[child + 1], _array[child]))
+				++child;
+
+			if (!_comparisionFunc(_array[child], item))
+				break;
+
+			_array[_index] = std::move(_array[child]);
+			_index = child;
+		}
+
+		_array[_index] = std::move(item);
+	}
+
+	/*
+		DESCRIPTION: Sorts the array by arranging it as a heap, then moving the item that belongs last from the top of 
+			the heap to the end of the array until the heap is empty.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare = std::greater<Type>>
+	void HeapSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare())
+	{
+		if (_arraySize < 2)
+			return;
+
+		// Build the heap from the bottom up. Items past the middle have no children.
+		for (unsigned int i = _arraySize / 2; i > 0; --i)
+			SiftDown(_array, i - 1, _arraySize, _comparisionFunc);
+
+		for (unsigned int heapSize = _arraySize - 1; heapSize > 0; --heapSize)
+		{
+			std::swap(_array[0], _array[heapSize]);
+			SiftDown(_array, 0, heapSize, _comparisionFunc);
+		}
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in ascending order by arranging it as a heap.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void HeapSortAscending(Type* _array, unsigned int _arraySize)
+	{
+		HeapSort(_array, _arraySize, std::greater<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in descending order by arranging it as a heap.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void HeapSortDescending(Type* _array, unsigned int _arraySize)
+	{
+		HeapSort(_array, _arraySize, std::less<Type>());
+	}
+
+	/*
+		DESCRIPTION: Helper function for MergeSort(). Sorts each half of the array, then merges them. Only the left half 
+			is moved to the buffer, and the merged items are written back from the front of the array, where they 
+			never overwrite an item of the right half that has not been merged yet.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Type* _buffer, uninitialized room for at least half of the items. It is left uninitialized again.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare>
+	void MergeSort(Type* _array, unsigned int _arraySize, Type* _buffer, Compare _comparisionFunc)
+	{
+		if (_arraySize <= SMALL_SORT_SIZE)
+		{
+			InsertionSort(_array, _arraySize, _comparisionFunc);
+			return;
+		}
+
+		const unsigned int middle = _arraySize / 2;
+
+		MergeSort(_array, middle, _buffer, _comparisionFunc);
+		MergeSort(_array + middle, _arraySize - middle, _buffer, _comparisionFunc);
+
+		// The halves are already in order, as they are when the array was sorted to begin with.
+		if (!_comparisionFunc(_array[middle - 1], _array[middle]))
+			return;
+
+		for (unsigned int i = 0; i < middle; ++i)
+			MoveInto(_buffer + i, _array[i], std::true_type());
+
+		unsigned int left = 0;
+		unsigned int right = middle;
+		unsigned int merged = 0;
+
+		// On a tie, the item from the left half goes first, which keeps the sort stable.
+		while (left < middle && right < _arraySize)
+		{
+			if (_comparisionFunc(_buffer[left], _array[right]))
+				_array[merged++] = std::move(_array[right++]);
+			else
+				_array[merged++] = std::move(_buffer[left++]);
+		}
+
+		// Any items left in the right half are already in place.
+		while (left < middle)
+			_array[merged++] = std::move(_buffer[left++]);
+
+		// Every item was moved back, so the buffer holds only moved-from items.
+		for (unsigned int i = 0; i < middle; ++i)
+			_buffer[i].~Type();
+	}
+
+	/*
+		DESCRIPTION: Sorts the array by sorting each half and merging them. Equal items keep their order.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare = std::greater<Type>>
+	void MergeSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare())
+	{
+		if (_arraySize <= SMALL_SORT_SIZE)
+		{
+			InsertionSort(_array, _arraySize, _comparisionFunc);
+			return;
+		}
+
+		Type* buffer = AllocateBuffer<Type>(_arraySize / 2);
+		MergeSort(_array, _arraySize, buffer, _comparisionFunc);
+		FreeBuffer(buffer, 0);
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in ascending order by sorting each half and merging them.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void MergeSortAscending(Type* _array, unsigned int _arraySize)
+	{
+		MergeSort(_array, _arraySize, std::greater<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in descending order by sorting each half and merging them.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void MergeSortDescending(Type* _array, unsigned int _arraySize)
+	{
+		MergeSort(_array, _arraySize, std::less<Type>());
+	}
+
+	/*
+		DESCRIPTION: Whether arrays of a type can be sorted by NetworkSort() with SIMD instructions.
+	*/
+	template<typename Type>
+	using IsNetworkSortable = std::integral_constant<bool, (std::is_floating_point<Type>::value || 
+		(std::is_integral<Type>::value && std::is_signed<Type>::value)) && (sizeof(Type) == 4 || sizeof(Type) == 8)>;
+
+#if defined(SIMD_X86)
+	/*
+		DESCRIPTION: Provides which lanes of a register take the maximum of a compare exchange, for a network that 
+			compares each lane with the lane a distance away. Runs of lanes of the given size are sorted in 
+			alternating directions, and a run as large as the register is sorted in ascending order.
+		PARAMETERS:
+			unsigned int _laneCount, the number of lanes in the register.
+			unsigned int _distance, the distance between the lanes compared.
+			unsigned int _runSize, the number of lanes in each run.
+		RETURNS: unsigned int - A blend mask with a bit set for each lane that takes the maximum.
+	*/
+	constexpr unsigned int NetworkMask(unsigned int _laneCount, unsigned int _distance, unsigned int _runSize)
+	{
+		unsigned int mask = 0;
+
+		for (unsigned int lane = 0; lane < _laneCount; ++lane)
+		{
+			if (((lane & _distance) != 0) != ((lane & _runSize) != 0))
+				mask |= 1u << lane;
+		}
+
+		return mask;
+	}
+
+	/*
+		DESCRIPTION: Loads, compares, and shuffles 256-bit registers of items, for each kind of type NetworkSort() 
+			supports. Exchange() swaps each lane with the lane a distance away, and Blend() takes the lanes set in the 
+			mask from the second register. Integers are ordered with Min() and Max(). Floating point numbers are 
+			ordered with IsGreater() and Select() instead, since the minimum and maximum of -0.0 and 0.0 can be the 
+			same zero, which would lose the other one.
+	*/
+	template<typename Type, unsigned int Size = sizeof(Type), bool IsFloat = std::is_floating_point<Type>::value>
+	struct Avx2SortLanes;
+
+	template<typename Type>
+	struct Avx2SortLanes<Type, 4, false>
+	{
+		using Register = __m256i;
+
+		static SIMD_TARGET_AVX2 inline Register Load(const Type* _items) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_items)); }
+		static SIMD_TARGET_AVX2 inline void Store(Type* _items, Register _a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(_items), _a); }
+		static SIMD_TARGET_AVX2 inline Register Min(Register _a, Register _b) { return _mm256_min_epi32(_a, _b); }
+		static SIMD_TARGET_AVX2 inline Register Max(Register _a, Register _b) { return _mm256_max_epi32(_a, _b); }
+		static SIMD_TARGET_AVX2 inline Register Reverse(Register _a) { return _mm256_permutevar8x32_epi32(_a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+
+		template<unsigned int Distance>
+		static SIMD_TARGET_AVX2 inline Register Exchange(Register _a)
+		{
+			if (Distance == 1)
+				return _mm256_shuffle_epi32(_a, _MM_SHUFFLE(2, 3, 0, 1));
+
+			if (Distance == 2)
+				return _mm256_shuffle_epi32(_a, _MM_SHUFFLE(1, 0, 3, 2));
+
+			return _mm256_permute2x128_si256(_a, _a, 1);
+		}
+
+		template<unsigned int Mask>
+		static SIMD_TARGET_AVX2 inline Register Blend(Register _a, Register _b) { return _mm256_blend_epi32(_a, _b, Mask); }
+	};
+
+	template<typename Type>
+	struct Avx2SortLanes<Type, 8, false>
+	{
+		using Register = __m256i;
+
+		static SIMD_TARGET_AVX2 inline Register Load(const Type* _items) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_items)); }
+		static SIMD_TARGET_AVX2 inline void Store(Type* _items, Register _a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(_items), _a); }
+
+		// AVX2 has no 64-bit minimum or maximum, so the greater items are found with a compare and picked with a blend.
+		static SIMD_TARGET_AVX2 inline Register Min(Register _a, Register _b) { return _mm256_blendv_epi8(_a, _b, _mm256_cmpgt_epi64(_a, _b)); }
+		static SIMD_TARGET_AVX2 inline Register Max(Register _a, Register _b) { return _mm256_blendv_epi8(_b, _a, _mm256_cmpgt_epi64(_a, _b)); }
+		static SIMD_TARGET_AVX2 inline Register Reverse(Register _a) { return _mm256_permute4x64_epi64(_a, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+		template<unsigned int Distance>
+		static SIMD_TARGET_AVX2 inline Register Exchange(Register _a)
+		{
+			if (Distance == 1)
+				return _mm256_permute4x64_epi64(_a, _MM_SHUFFLE(2, 3, 0, 1));
+
+			return _mm256_permute4x64_epi64(_a, _MM_SHUFFLE(1, 0, 3, 2));
+		}
+
+		template<unsigned int Mask>
+		static SIMD_TARGET_AVX2 inline Register Blend(Register _a, Register _b) 
+		{ 
+			return _mm256_castpd_si256(_mm256_blend_pd(_mm256_castsi256_pd(_a), _mm256_castsi256_pd(_b), Mask));
+		}
+	};
+
+	template<typename Type>
+	struct Avx2SortLanes<Type, 4, true>
+	{
+		using Register = __m256;
+
+		static SIMD_TARGET_AVX2 inline Register Load(const Type* _items) { return _mm256_loadu_ps(_items); }
+		static SIMD_TARGET_AVX2 inline void Store(Type* _items, Register _a) { _mm256_storeu_ps(_items, _a); }
+		static SIMD_TARGET_AVX2 inline Register IsGreater(Register _a, Register _b) { return _mm256_cmp_ps(_a, _b, _CMP_GT_OQ); }
+		static SIMD_TARGET_AVX2 inline Register Select(Register _a, Register _b, Register _mask) { return _mm256_blendv_ps(_a, _b, _mask); }
+		static SIMD_TARGET_AVX2 inline Register Reverse(Register _a) { return _mm256_permutevar8x32_ps(_a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+
+		template<unsigned int Distance>
+		static SIMD_TARGET_AVX2 inline Register Exchange(Register _a)
+		{
+			if (Distance == 1)
+				return _mm256_shuffle_ps(_a, _a, _MM_SHUFFLE(2, 3, 0, 1));
+
+			if (Distance == 2)
+				return _mm256_shuffle_ps(_a, _a, _MM_SHUFFLE(1, 0, 3, 2));
+
+			return _mm256_permute2f128_ps(_a, _a, 1);
+		}
+
+		template<unsigned int Mask>
+		static SIMD_TARGET_AVX2 inline Register Blend(Register _a, Register _b) { return _mm256_blend_ps(_a, _b, Mask); }
+	};
+
+	template<typename Type>
+	struct Avx2SortLanes<Type, 8, true>
+	{
+		using Register = __m256d;
+
+		static SIMD_TARGET_AVX2 inline Register Load(const Type* _items) { return _mm256_loadu_pd(_items); }
+		static SIMD_TARGET_AVX2 inline void Store(Type* _items, Register _a) { _mm256_storeu_pd(_items, _a); }
+		static SIMD_TARGET_AVX2 inline Register IsGreater(Register _a, Register _b) { return _mm256_cmp_pd(_a, _b, _CMP_GT_OQ); }
+		static SIMD_TARGET_AVX2 inline Register Select(Register _a, Register _b, Register _mask) { return _mm256_blendv_pd(_a, _b, _mask); }
+		static SIMD_TARGET_AVX2 inline Register Reverse(Register _a) { return _mm256_permute4x64_pd(_a, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+		template<unsigned int Distance>
+		static SIMD_TARGET_AVX2 inline Register Exchange(Register _a)
+		{
+			if (Distance == 1)
+				return _mm256_permute4x64_pd(_a, _MM_SHUFFLE(2, 3, 0, 1));
+
+			return _mm256_permute4x64_pd(_a, _MM_SHUFFLE(1, 0, 3, 2));
+		}
+
+		template<unsigned int Mask>
+		static SIMD_TARGET_AVX2 inline Register Blend(Register _a, Register _b) { return _mm256_blend_pd(_a, _b, Mask); }
+	};
+
+	/*
+		DESCRIPTION: Orders two registers lane by lane, leaving the lesser item of each lane in the first register and 
+			the greater in the second. Equal items are left where they are.
+		PARAMETERS:
+			Register& _lesser, the first register of items.
+			Register& _greater, the second register of items.
+			std::true_type if Type is a floating point type, or std::false_type if it is an integer type.
+	*/
+	template<typename Type>
+	SIMD_TARGET_AVX2 inline void Avx2MinMax(typename Avx2SortLanes<Type>::Register& _lesser, typename Avx2SortLanes<Type>::Register& _greater, std::false_type)
+	{
+		using Lanes = Avx2SortLanes<Type>;
+
+		const typename Lanes::Register lesser = Lanes::Min(_lesser, _greater);
+		_greater = Lanes::Max(_lesser, _greater);
+		_lesser = lesser;
+	}
+
+	template<typename Type>
+	SIMD_TARGET_AVX2 inline void Avx2MinMax(typename Avx2SortLanes<Type>::Register& _lesser, typename Avx2SortLanes<Type>::Register& _greater, std::true_type)
+	{
+		using Lanes = Avx2SortLanes<Type>;
+
+		// Both registers are picked from the same compare, so each item ends up in exactly one of them.
+		const typename Lanes::Register isSwapped = Lanes::IsGreater(_lesser, _greater);
+		const typename Lanes::Register lesser = Lanes::Select(_lesser, _greater, isSwapped);
+		_greater = Lanes::Select(_greater, _lesser, isSwapped);
+		_lesser = lesser;
+	}
+
+	/*
+		DESCRIPTION: Compares each lane of a register with the lane a distance away, keeping the minimum in one lane 
+			and the maximum in the other. See NetworkMask() for which lane keeps which. Equal items are left where 
+			they are.
+		PARAMETERS:
+			Register _a, the register of items.
+			std::true_type if Type is a floating point type, or std::false_type if it is an integer type.
+		RETURNS: Register - The items after the compare exchange.
+	*/
+	template<typename Type, unsigned int Distance, unsigned int RunSize>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2CompareExchange(typename Avx2SortLanes<Type>::Register _a, std::false_type)
+	{
+		using Lanes = Avx2SortLanes<Type>;
+		constexpr unsigned int LANE_COUNT = 32 / sizeof(Type);
+
+		const typename Lanes::Register exchanged = Lanes::template Exchange<Distance>(_a);
+
+		return Lanes::template Blend<NetworkMask(LANE_COUNT, Distance, RunSize)>(Lanes::Min(_a, exchanged), Lanes::Max(_a, exchanged));
+	}
+
+	template<typename Type, unsigned int Distance, unsigned int RunSize>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2CompareExchange(typename Avx2SortLanes<Type>::Register _a, std::true_type)
+	{
+		using Lanes = Avx2SortLanes<Type>;
+		constexpr unsigned int LANE_COUNT = 32 / sizeof(Type);
+
+		const typename Lanes::Register exchanged = Lanes::template Exchange<Distance>(_a);
+
+		// Only the lanes that keep the minimum compare. Each partner lane takes the same answer, so a pair swaps both 
+		// of its items or neither.
+		const typename Lanes::Register isGreater = Lanes::IsGreater(_a, exchanged);
+		const typename Lanes::Register isSwapped = Lanes::template Blend<NetworkMask(LANE_COUNT, Distance, RunSize)>(isGreater, Lanes::template Exchange<Distance>(isGreater));
+
+		return Lanes::Select(_a, exchanged, isSwapped);
+	}
+
+	template<typename Type, unsigned int Distance, unsigned int RunSize>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2CompareExchange(typename Avx2SortLanes<Type>::Register _a)
+	{
+		return Avx2CompareExchange<Type, Distance, RunSize>(_a, std::is_floating_point<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the items within a register. 4 lanes take 3 compare exchanges, and 8 lanes take 6.
+		PARAMETERS:
+			Register _a, the register of items.
+			std::integral_constant<unsigned int, 4 or 8>, the number of lanes in the register.
+		RETURNS: Register - The items in ascending order.
+	*/
+	template<typename Type>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2SortRegister(typename Avx2SortLanes<Type>::Register _a, std::integral_constant<unsigned int, 4>)
+	{
+		_a = Avx2CompareExchange<Type, 1, 2>(_a);
+		_a = Avx2CompareExchange<Type, 2, 4>(_a);
+		return Avx2CompareExchange<Type, 1, 4>(_a);
+	}
+
+	template<typename Type>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2SortRegister(typename Avx2SortLanes<Type>::Register _a, std::integral_constant<unsigned int, 8>)
+	{
+		_a = Avx2CompareExchange<Type, 1, 2>(_a);
+		_a = Avx2CompareExchange<Type, 2, 4>(_a);
+		_a = Avx2CompareExchange<Type, 1, 4>(_a);
+		_a = Avx2CompareExchange<Type, 4, 8>(_a);
+		_a = Avx2CompareExchange<Type, 2, 8>(_a);
+		return Avx2CompareExchange<Type, 1, 8>(_a);
+	}
+
+	/*
+		DESCRIPTION: Sorts the items within a register that rise then fall, the last step of merging sorted registers.
+		PARAMETERS:
+			Register _a, the register of items.
+			std::integral_constant<unsigned int, 4 or 8>, the number of lanes in the register.
+		RETURNS: Register - The items in ascending order.
+	*/
+	template<typename Type>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2MergeRegister(typename Avx2SortLanes<Type>::Register _a, std::integral_constant<unsigned int, 4>)
+	{
+		_a = Avx2CompareExchange<Type, 2, 4>(_a);
+		return Avx2CompareExchange<Type, 1, 4>(_a);
+	}
+
+	template<typename Type>
+	SIMD_TARGET_AVX2 inline typename Avx2SortLanes<Type>::Register Avx2MergeRegister(typename Avx2SortLanes<Type>::Register _a, std::integral_constant<unsigned int, 8>)
+	{
+		_a = Avx2CompareExchange<Type, 4, 8>(_a);
+		_a = Avx2CompareExchange<Type, 2, 8>(_a);
+		return Avx2CompareExchange<Type, 1, 8>(_a);
+	}
+
+	/*
+		DESCRIPTION: Sorts registers of items as one sequence. Each register is sorted, then runs of sorted registers 
+			are merged in pairs until one run is left.
+		PARAMETERS:
+			Register* _registers, the registers of items.
+	*/
+	template<typename Type, unsigned int RegisterCount>
+	SIMD_TARGET_AVX2 void Avx2SortRegisters(typename Avx2SortLanes<Type>::Register* _registers)
+	{
+		using Lanes = Avx2SortLanes<Type>;
+		using LaneCount = std::integral_constant<unsigned int, 32 / sizeof(Type)>;
+
+		for (unsigned int i = 0; i < RegisterCount; ++i)
+			_registers[i] = Avx2SortRegister<Type>(_registers[i], LaneCount());
+
+		for (unsigned int runSize = 1; runSize < RegisterCount; runSize *= 2)
+		{
+			for (unsigned int first = 0; first < RegisterCount; first += 2 * runSize)
+			{
+				typename Lanes::Register* run = _registers + first;
+
+				// Reverse the second run, so the pair of runs rises then falls.
+				for (unsigned int i = 0; i < runSize / 2; ++i)
+				{
+					const typename Lanes::Register swapped = run[runSize + i];
+					run[runSize + i] = run[2 * runSize - 1 - i];
+					run[2 * runSize - 1 - i] = swapped;
+				}
+
+				for (unsigned int i = runSize; i < 2 * runSize; ++i)
+					run[i] = Lanes::Reverse(run[i]);
+
+				// Compare registers half the run apart, then a quarter, and so on, then the lanes within each register.
+				for (unsigned int distance = runSize; distance > 0; distance /= 2)
+				{
+					for (unsigned int i = 0; i < 2 * runSize; ++i)
+					{
+						if ((i & distance) == 0)
+							Avx2MinMax<Type>(run[i], run[i + distance], std::is_floating_point<Type>());
+					}
+				}
+
+				for (unsigned int i = 0; i < 2 * runSize; ++i)
+					run[i] = Avx2MergeRegister<Type>(run[i], LaneCount());
+			}
+		}
+	}
+
+	/*
+		DESCRIPTION: Sorts up to NETWORK_SORT_SIZE items in ascending order with a bitonic sorting network, comparing 
+			32 bytes of items at a time. The items are copied into a block padded with the highest value of the type 
+			to a power of two registers. The CPU must support AVX2.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	SIMD_TARGET_AVX2 void Avx2NetworkSort(Type* _array, unsigned int _arraySize)
+	{
+		using Lanes = Avx2SortLanes<Type>;
+		constexpr unsigned int LANE_COUNT = 32 / sizeof(Type);
+
+		const Type highest = (std::numeric_limits<Type>::has_infinity) ? std::numeric_limits<Type>::infinity() : std::numeric_limits<Type>::max();
+
+		unsigned int registerCount = 1;
+
+		while (registerCount * LANE_COUNT < _arraySize)
+			registerCount *= 2;
+
+		Type block[NETWORK_SORT_SIZE];
+
+		for (unsigned int i = 0; i < _arraySize; ++i)
+			block[i] = _array[i];
+
+		for (unsigned int i = _arraySize; i < registerCount * LANE_COUNT; ++i)
+			block[i] = highest;
+
+		typename Lanes::Register registers[NETWORK_SORT_SIZE / LANE_COUNT];
+
+		for (unsigned int i = 0; i < registerCount; ++i)
+			registers[i] = Lanes::Load(block + i * LANE_COUNT);
+
+		// Each size of network is a separate function, so that its loops can be unrolled and its registers kept out of memory.
+		if (registerCount == 1)
+			Avx2SortRegisters<Type, 1>(registers);
+		else if (registerCount == 2)
+			Avx2SortRegisters<Type, 2>(registers);
+		else if (registerCount == 4)
+			Avx2SortRegisters<Type, 4>(registers);
+		else if (registerCount == 8)
+			Avx2SortRegisters<Type, 8>(registers);
+		else
+			Avx2SortRegisters<Type, NETWORK_SORT_SIZE / LANE_COUNT>(registers);
+
+		for (unsigned int i = 0; i < registerCount; ++i)
+			Lanes::Store(block + i * LANE_COUNT, registers[i]);
+
+		for (unsigned int i = 0; i < _arraySize; ++i)
+			_array[i] = block[i];
+	}
+#endif
+
+	/*
+		DESCRIPTION: Sorts up to NETWORK_SORT_SIZE items in ascending order. Arrays of 32-bit and 64-bit signed integers 
+			and floating point numbers are sorted with a sorting network using the widest SIMD instructions allowed. All 
+			other arrays, arrays with NaNs, and CPUs without AVX2 fall back to InsertionSort().
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array. At most NETWORK_SORT_SIZE.
+			Simd::Level _level, the widest SIMD instructions to use. Must be supported by the CPU.
+	*/
+	template<typename Type>
+	void NetworkSort(Type* _array, unsigned int _arraySize, Simd::Level, std::false_type)
+	{
+		InsertionSort(_array, _arraySize);
+	}
+
+	template<typename Type>
+	void NetworkSort(Type* _array, unsigned int _arraySize, Simd::Level _level, std::true_type)
+	{
+#if defined(SIMD_X86)
+		// A NaN is not ordered with any number, so the minimum and maximum of a pair could both be the NaN.
+		bool hasNaN = false;
+
+		for (unsigned int i = 0; i < _arraySize; ++i)
+			hasNaN = hasNaN || !(_array[i] == _array[i]);
+
+		if (_level == Simd::Level::AVX2 && !hasNaN)
+		{
+			Avx2NetworkSort(_array, _arraySize);
+			return;
+		}
+#else
+		(void)_level; // Only x86 CPUs have a network to choose.
+#endif
+
+		InsertionSort(_array, _arraySize);
+	}
+
+	template<typename Type>
+	void NetworkSort(Type* _array, unsigned int _arraySize, Simd::Level _level = Simd::SupportedLevel())
+	{
+		assert(_arraySize <= NETWORK_SORT_SIZE);
+		assert(_level <= Simd::SupportedLevel());
+
+		NetworkSort(_array, _arraySize, _level, IsNetworkSortable<Type>());
+	}
+
+	/*
+		DESCRIPTION: Whether SmallSort() finishes parts with NetworkSort(), which needs a type it can sort with SIMD 
+			instructions, in ascending order.
+	*/
+	template<typename Type, typename Compare>
+	using IsNetworkSmallSort = std::integral_constant<bool, IsNetworkSortable<Type>::value && std::is_same<Compare, std::greater<Type>>::value>;
+
+	/*
+		DESCRIPTION: Helper function for QuickSort(). Sorts a part small enough to finish without partitioning, with 
+			NetworkSort() when it can and InsertionSort() otherwise.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare>
+	void SmallSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc, std::false_type)
+	{
+		InsertionSort(_array, _arraySize, _comparisionFunc);
+	}
+
+	template<typename Type, typename Compare>
+	void SmallSort(Type* _array, unsigned int _arraySize, Compare, std::true_type)
+	{
+		NetworkSort(_array, _arraySize);
+	}
+
+	template<typename Type, typename Compare>
+	void SmallSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc)
+	{
+		SmallSort(_array, _arraySize, _comparisionFunc, IsNetworkSmallSort<Type, Compare>());
+	}
+
+	/*
+		DESCRIPTION: Helper function for QuickSort(). Moves the median of three items to the front of the array, to be 
+			used as the pivot. The other two items are left in the array, one on each side of the pivot, so the 
+			partition loops always stop before leaving the array.
+		PARAMETERS:
+			Type* _array, the array to partition. Must have at least 3 items.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare>
+	void MoveMedianToFront(Type* _array, unsigned int _arraySize, Compare _comparisionFunc)
+	{
+		Type* a = _array + 1;
+		Type* b = _array + _arraySize / 2;
+		Type* c = _array + _arraySize - 1;
+
+		// Order a, b, and c, then b is the median.
+		if (_comparisionFunc(*a, *b))
+			std::swap(*a, *b);
+
+		if (_comparisionFunc(*b, *c))
+		{
+			std::swap(*b, *c);
+
+			if (_comparisionFunc(*a, *b))
+				std::swap(*a, *b);
+		}
+
+		std::swap(*_array, *b);
+	}
+
+	/*
+		DESCRIPTION: Helper function for QuickSort(). Splits the array around the pivot at the front. Items that belong 
+			before the pivot end up in the first part, and items that belong after it in the second. Items equal to the 
+			pivot stop both scans and are swapped, so arrays with many equal items are still split in half.
+		PARAMETERS:
+			Type* _array, the array to partition, with the pivot at the front.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+		RETURNS: unsigned int - The number of items in the first part. Both parts hold at least one item.
+	*/
+	template<typename Type, typename Compare>
+	unsigned int Partition(Type* _array, unsigned int _arraySize, Compare _comparisionFunc)
+	{
+		const Type& pivot = _array[0];
+		unsigned int left = 1;
+		unsigned int right = _arraySize;
+
+		while (true)
+		{
+			while (_comparisionFunc(pivot, _array[left]))
+				++left;
+
+			--right;
+
+			while (_comparisionFunc(_array[right], pivot))
+				--right;
+
+			if (left >= right)
+				return left;
+
+			std::swap(_array[left], _array[right]);
+			++left;
+		}
+	}
+
+	/*
+		DESCRIPTION: Helper function for QuickSort(). Partitions the array until the parts are small enough for 
+			SmallSort(). Only the smaller part is sorted by a recursive call, so the call stack never holds more 
+			than log N calls. If partitioning goes deeper than the limit, the pivots have been poor and the part is 
+			sorted with HeapSort() instead.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			unsigned int _depthLimit, the number of partitions left before switching to HeapSort().
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare>
+	void IntroSort(Type* _array, unsigned int _arraySize, unsigned int _depthLimit, Compare _comparisionFunc)
+	{
+		// A network sorts a part of 64 items faster than partitioning it further does.
+		const unsigned int smallSortSize = (IsNetworkSmallSort<Type, Compare>::value) ? NETWORK_SORT_SIZE : SMALL_SORT_SIZE;
+
+		while (_arraySize > smallSortSize)
+		{
+			if (_depthLimit == 0)
+			{
+				HeapSort(_array, _arraySize, _comparisionFunc);
+				return;
+			}
+
+			--_depthLimit;
+
+			MoveMedianToFront(_array, _arraySize, _comparisionFunc);
+			const unsigned int split = Partition(_array, _arraySize, _comparisionFunc);
+
+			if (split < _arraySize - split)
+			{
+				IntroSort(_array, split, _depthLimit, _comparisionFunc);
+				_array += split;
+				_arraySize -= split;
+			}
+			else
+			{
+				IntroSort(_array + split, _arraySize - split, _depthLimit, _comparisionFunc);
+				_arraySize = split;
+			}
+		}
+
+		SmallSort(_array, _arraySize, _comparisionFunc);
+	}
+
+	/*
+		DESCRIPTION: Sorts the array by partitioning it around the median of three items, then sorting each part. An 
+			array that keeps getting poor pivots is finished with HeapSort(), so the worst case is O(N log N), and small 
+			parts are finished with SmallSort().
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+	*/
+	template<typename Type, typename Compare = std::greater<Type>>
+	void QuickSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare())
+	{
+		// Allow 2 log N levels of partitions, twice as many as perfect pivots need.
+		unsigned int depthLimit = 0;
+
+		for (unsigned int size = _arraySize; size > 1; size /= 2)
+			depthLimit += 2;
+
+		IntroSort(_array, _arraySize, depthLimit, _comparisionFunc);
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in ascending order by partitioning it.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void QuickSortAscending(Type* _array, unsigned int _arraySize)
+	{
+		QuickSort(_array, _arraySize, std::greater<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in descending order by partitioning it.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void QuickSortDescending(Type* _array, unsigned int _arraySize)
+	{
+		QuickSort(_array, _arraySize, std::less<Type>());
+	}
+
+	/*
+		DESCRIPTION: Helper function for ParallelSort(). Finds how many items of the left array are among the first 
+			items of the merge of two sorted arrays. A binary search finds the split, so the merge can be divided 
+			between threads without merging the items before it.
+		PARAMETERS:
+			const Type* _left, the first sorted array. Its items go first on a tie.
+			unsigned int _leftSize, the number of items in the left array.
+			const Type* _right, the second sorted array.
+			unsigned int _rightSize, the number of items in the right array.
+			unsigned int _mergedCount, the number of merged items to split.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+		RETURNS: unsigned int - The number of items from the left array. The rest are from the right array.
+	*/
+	template<typename Type, typename Compare>
+	unsigned int MergeSplit(const Type* _left, unsigned int _leftSize, const Type* _right, unsigned int _rightSize, 
+		unsigned int _mergedCount, Compare _comparisionFunc)
+	{
+		unsigned int low = (_mergedCount > _rightSize) ? _mergedCount - _rightSize : 0;
+		unsigned int high = (_mergedCount < _leftSize) ? _mergedCount : _leftSize;
+
+		// A left item is among the merged items if it goes before the right item that would otherwise fill its place.
+		while (low < high)
+		{
+			const unsigned int middle = low + (high - low) / 2;
+
+			if (_comparisionFunc(_left[middle], _right[_mergedCount - middle - 1]))
+				high = middle;
+			else
+				low = middle + 1;
+		}
+
+		return low;
+	}
+
+	/*
+		DESCRIPTION: Helper function for ParallelSort(). Moves the items of two sorted arrays into an output array in 
+			sorted order.
+		PARAMETERS:
+			Type* _left, the first sorted array. Its items go first on a tie.
+			unsigned int _leftSize, the number of items in the left array.
+			Type* _right, the second sorted array.
+			unsigned int _rightSize, the number of items in the right array.
+			Type* _outArray, the array to write the items to. Must have room for all of them.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+			IsUninitialized, std::true_type if the output array is uninitialized, or std::false_type if it holds items.
+	*/
+	template<typename Type, typename Compare, typename IsUninitialized>
+	void Merge(Type* _left, unsigned int _leftSize, Type* _right, unsigned int _rightSize, Type* _outArray, 
+		Compare _comparisionFunc, IsUninitialized)
+	{
+		unsigned int left = 0;
+		unsigned int right = 0;
+
+		while (left < _leftSize && right < _rightSize)
+		{
+			if (_comparisionFunc(_left[left], _right[right]))
+				MoveInto(_outArray++, _right[right++], IsUninitialized());
+			else
+				MoveInto(_outArray++, _left[left++], IsUninitialized());
+		}
+
+		while (left < _leftSize)
+			MoveInto(_outArray++, _left[left++], IsUninitialized());
+
+		while (right < _rightSize)
+			MoveInto(_outArray++, _right[right++], IsUninitialized());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array on several threads. The array is split into one part per thread, and each part is 
+			sorted with QuickSort(). Then pairs of parts are merged until one is left. Each merge is split into ranges 
+			by binary searches, and the ranges are merged on separate threads, so every thread has work until the end. 
+			Arrays too small to give each thread enough items are sorted on fewer threads, or with QuickSort() on the 
+			calling thread.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			Compare _comparisionFunc, function to determine order. Returns true if the first item belongs after the second.
+				It is called from several threads at once.
+			unsigned int _threadCount, the most threads to use. 0 uses one thread per hardware thread.
+			unsigned int _threshold, the fewest items to give each thread.
+	*/
+	template<typename Type, typename Compare = std::greater<Type>>
+	void ParallelSort(Type* _array, unsigned int _arraySize, Compare _comparisionFunc = Compare(), unsigned int _threadCount = 0, 
+		unsigned int _threshold = PARALLEL_SORT_THRESHOLD)
+	{
+		if (_threadCount == 0)
+			_threadCount = std::thread::hardware_concurrency();
+
+		if (_threshold == 0)
+			_threshold = 1;
+
+		if (_threadCount > _arraySize / _threshold)
+			_threadCount = _arraySize / _threshold;
+
+		if (_threadCount < 2)
+		{
+			QuickSort(_array, _arraySize, _comparisionFunc);
+			return;
+		}
+
+		std::thread* threads = new std::thread[_threadCount];
+		unsigned int* bounds = new unsigned int[_threadCount + 1]; // Where each part starts, then where the array ends.
+
+		for (unsigned int i = 0; i <= _threadCount; ++i)
+			bounds[i] = static_cast<unsigned int>(static_cast<unsigned long long>(_arraySize) * i / _threadCount);
+
+		for (unsigned int i = 0; i < _threadCount; ++i)
+		{
+			Type* part = _array + bounds[i];
+			const unsigned int partSize = bounds[i + 1] - bounds[i];
+
+			threads[i] = std::thread([part, partSize, _comparisionFunc]() { QuickSort(part, partSize, _comparisionFunc); });
+		}
+
+		for (unsigned int i = 0; i < _threadCount; ++i)
+			threads[i].join();
+
+		// Each round merges pairs of parts from one array into the other, halving the number of parts. The first round 
+		// moves every item into the buffer, which constructs them there.
+		Type* buffer = AllocateBuffer<Type>(_arraySize);
+		Type* source = _array;
+		Type* destination = buffer;
+		bool isBufferConstructed = false;
+
+		for (unsigned int partCount = _threadCount; partCount > 1; partCount = (partCount + 1) / 2)
+		{
+			const unsigned int pairCount = (partCount + 1) / 2;
+			const unsigned int threadsPerPair = (_threadCount / pairCount > 0) ? _threadCount / pairCount : 1;
+			unsigned int threadCount = 0;
+
+			for (unsigned int pair = 0; pair < pairCount; ++pair)
+			{
+				// A part without a pair is merged with nothing, which moves it to the other array.
+				const unsigned int first = bounds[2 * pair];
+				const unsigned int middle = bounds[(2 * pair + 1 < partCount) ? 2 * pair + 1 : partCount];
+				const unsigned int last = bounds[(2 * pair + 2 < partCount) ? 2 * pair + 2 : partCount];
+
+				// Every split of a merge is found before its threads start moving items out of the source array.
+				const unsigned int leftSize = middle - first;
+				const unsigned int rightSize = last - middle;
+				unsigned int rangeFirst = 0;
+				unsigned int leftFirst = 0;
+
+				for (unsigned int i = 0; i < threadsPerPair; ++i)
+				{
+					const unsigned int rangeLast = static_cast<unsigned int>(static_cast<unsigned long long>(last - first) * (i + 1) / threadsPerPair);
+					const unsigned int leftLast = MergeSplit(source + first, leftSize, source + middle, rightSize, rangeLast, _comparisionFunc);
+
+					Type* left = source + first + leftFirst;
+					Type* right = source + middle + (rangeFirst - leftFirst);
+					Type* merged = destination + first + rangeFirst;
+					const unsigned int rangeLeftSize = leftLast - leftFirst;
+					const unsigned int rangeRightSize = (rangeLast - rangeFirst) - rangeLeftSize;
+
+					if (isBufferConstructed)
+					{
+						threads[threadCount++] = std::thread([left, rangeLeftSize, right, rangeRightSize, merged, _comparisionFunc]()
+						{
+							Merge(left, rangeLeftSize, right, rangeRightSize, merged, _comparisionFunc, std::false_type());
+						});
+					}
+					else
+					{
+						threads[threadCount++] = std::thread([left, rangeLeftSize, right, rangeRightSize, merged, _comparisionFunc]()
+						{
+							Merge(left, rangeLeftSize, right, rangeRightSize, merged, _comparisionFunc, std::true_type());
+						});
+					}
+
+					rangeFirst = rangeLast;
+					leftFirst = leftLast;
+				}
+
+				// Only bounds of pairs already read are replaced.
+				bounds[pair] = first;
+			}
+
+			bounds[pairCount] = _arraySize;
+
+			for (unsigned int i = 0; i < threadCount; ++i)
+				threads[i].join();
+
+			isBufferConstructed = true;
+			std::swap(source, destination);
+		}
+
+		// After an odd number of rounds, the sorted items are in the buffer.
+		if (source != _array)
+		{
+			for (unsigned int i = 0; i < _threadCount; ++i)
+			{
+				const unsigned int first = static_cast<unsigned int>(static_cast<unsigned long long>(_arraySize) * i / _threadCount);
+				const unsigned int last = static_cast<unsigned int>(static_cast<unsigned long long>(_arraySize) * (i + 1) / _threadCount);
+
+				threads[i] = std::thread([=]()
+				{
+					for (unsigned int j = first; j < last; ++j)
+						_array[j] = std::move(buffer[j]);
+				});
+			}
+
+			for (unsigned int i = 0; i < _threadCount; ++i)
+				threads[i].join();
+		}
+
+		FreeBuffer(buffer, _arraySize);
+		delete[] bounds;
+		delete[] threads;
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in ascending order on one thread per hardware thread.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void ParallelSortAscending(Type* _array, unsigned int _arraySize)
+	{
+		ParallelSort(_array, _arraySize, std::greater<Type>());
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in descending order on one thread per hardware thread.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void ParallelSortDescending(Type* _array, unsigned int _arraySize)
+	{
+		ParallelSort(_array, _arraySize, std::less<Type>());
+	}
+
+	/*
+		DESCRIPTION: Maps keys of an arithmetic type to unsigned integers that are in the same order, so RadixSort() can 
+			sort by their bytes. Signed integers have the sign bit flipped, so negative numbers come first. Floating 
+			point numbers have every bit flipped if they are negative, so larger magnitudes come first, and only the 
+			sign bit flipped otherwise. That puts -0.0 before 0.0, and NaNs before or after every other number, 
+			depending on their sign bit.
+	*/
+	template<typename Key, bool IsFloat = std::is_floating_point<Key>::value>
+	struct RadixKey;
+
+	template<typename Key>
+	struct RadixKey<Key, false>
+	{
+		static_assert(std::is_integral<Key>::value && !std::is_same<Key, bool>::value, "RadixSort() keys must be integers or floating point numbers.");
+
+		using Bits = typename std::make_unsigned<Key>::type;
+
+		static inline Bits ToBits(Key _key)
+		{
+			const Bits signBit = (std::is_signed<Key>::value) ? static_cast<Bits>(Bits(1) << (sizeof(Bits) * 8 - 1)) : Bits(0);
+			return static_cast<Bits>(static_cast<Bits>(_key) ^ signBit);
+		}
+	};
+
+	template<typename Key>
+	struct RadixKey<Key, true>
+	{
+		static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "RadixSort() floating point keys must be 32 or 64 bits.");
+
+		using Bits = typename std::conditional<sizeof(Key) == 4, uint32_t, uint64_t>::type;
+
+		static inline Bits ToBits(Key _key)
+		{
+			Bits bits;
+			std::memcpy(&bits, &_key, sizeof(Bits));
+
+			const Bits signBit = Bits(1) << (sizeof(Bits) * 8 - 1);
+			return (bits & signBit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+		}
+	};
+
+	/*
+		DESCRIPTION: Helper function for RadixSort(). Sorts the array by its keys, one byte at a time from the lowest 
+			byte to the highest. Each pass moves the items into the other array in the order of that byte, keeping 
+			the order of the earlier passes for items with the same byte. The bytes of every key are counted in one 
+			pass before the items are moved, and a byte that is the same for every item is skipped.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			KeyFunc _keyFunc, function that returns the key of an item, an integer or floating point number.
+			bool _isDescending, if the items are sorted from the highest key to the lowest.
+	*/
+	template<typename Type, typename KeyFunc>
+	void RadixSort(Type* _array, unsigned int _arraySize, KeyFunc _keyFunc, bool _isDescending)
+	{
+		using Key = typename std::decay<decltype(_keyFunc(*_array))>::type;
+		using Bits = typename RadixKey<Key>::Bits;
+
+		// Flipping every bit of the keys reverses their order.
+		const Bits flipBits = (_isDescending) ? static_cast<Bits>(~Bits(0)) : Bits(0);
+		const auto toBits = [&_keyFunc, flipBits](const Type& _item) { return static_cast<Bits>(RadixKey<Key>::ToBits(_keyFunc(_item)) ^ flipBits); };
+
+		if (_arraySize < RADIX_SORT_THRESHOLD)
+		{
+			InsertionSort(_array, _arraySize, [&toBits](const Type& _lhs, const Type& _rhs) { return toBits(_lhs) > toBits(_rhs); });
+			return;
+		}
+
+		unsigned int counts[sizeof(Bits)][256] = {};
+
+		for (unsigned int i = 0; i < _arraySize; ++i)
+		{
+			const Bits bits = toBits(_array[i]);
+
+			for (unsigned int byte = 0; byte < sizeof(Bits); ++byte)
+				++counts[byte][(bits >> (8 * byte)) & 0xFF];
+		}
+
+		// The first pass that isn't skipped moves every item into the buffer, which constructs them there.
+		Type* buffer = AllocateBuffer<Type>(_arraySize);
+		Type* source = _array;
+		Type* destination = buffer;
+		unsigned int constructedCount = 0;
+		const Bits firstBits = toBits(_array[0]);
+
+		for (unsigned int byte = 0; byte < sizeof(Bits); ++byte)
+		{
+			unsigned int* offsets = counts[byte];
+
+			if (offsets[(firstBits >> (8 * byte)) & 0xFF] == _arraySize)
+				continue;
+
+			// Turn the counts into the index where the items with each byte start.
+			unsigned int offset = 0;
+
+			for (unsigned int digit = 0; digit < 256; ++digit)
+			{
+				const unsigned int count = offsets[digit];
+				offsets[digit] = offset;
+				offset += count;
+			}
+
+			if (constructedCount == 0)
+			{
+				for (unsigned int i = 0; i < _arraySize; ++i)
+					MoveInto(destination + offsets[(toBits(source[i]) >> (8 * byte)) & 0xFF]++, source[i], std::true_type());
+
+				constructedCount = _arraySize;
+			}
+			else
+			{
+				for (unsigned int i = 0; i < _arraySize; ++i)
+					destination[offsets[(toBits(source[i]) >> (8 * byte)) & 0xFF]++] = std::move(source[i]);
+			}
+
+			std::swap(source, destination);
+		}
+
+		// After an odd number of passes, the sorted items are in the buffer.
+		if (source != _array)
+		{
+			for (unsigned int i = 0; i < _arraySize; ++i)
+				_array[i] = std::move(source[i]);
+		}
+
+		FreeBuffer(buffer, constructedCount);
+	}
+
+	/*
+		DESCRIPTION: Sorts the array in ascending order of a key, such as an integer member of a struct. Items with equal 
+			keys keep their order.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+			KeyFunc _keyFunc, function that returns the key of an item, an integer or floating point number.
+	*/
+	template<typename Type, typename KeyFunc>
+	void RadixSort(Type* _array, unsigned int _arraySize, KeyFunc _keyFunc)
+	{
+		RadixSort(_array, _arraySize, _keyFunc, false);
+	}
+
+	/*
+		DESCRIPTION: Sorts an array of integers or floating point numbers in ascending order, one byte at a time.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void RadixSort(Type* _array, unsigned int _arraySize)
+	{
+		RadixSort(_array, _arraySize, [](const Type& _item) { return _item; }, false);
+	}
+
+	/*
+		DESCRIPTION: Sorts an array of integers or floating point numbers in ascending order, one byte at a time.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void RadixSortAscending(Type* _array, unsigned int _arraySize)
+	{
+		RadixSort(_array, _arraySize, [](const Type& _item) { return _item; }, false);
+	}
+
+	/*
+		DESCRIPTION: Sorts an array of integers or floating point numbers in descending order, one byte at a time.
+		PARAMETERS:
+			Type* _array, the array to sort.
+			unsigned int _arraySize, the number of items in the array.
+	*/
+	template<typename Type>
+	void RadixSortDescending(Type* _array, unsigned int _arraySize)
+	{
+		RadixSort(_array, _arraySize, [](const Type& _item) { return _item; }, true);
 	}
 }
@@ -2,27 +2,51 @@
 	FILE: AVLTree.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 26, 2021
-	MODIFIED: January 29, 2021
-	DESCRIPTION: A templated AVL Tree data structure. The benefits of the AVL are:
+	MODIFIED: October 16, 2026
+	DESCRIPTION: A templated AVL Tree data structure. Traversals, Find(), Clear(), and copies are iterative, and 
+		Insert() and Remove() only recurse as deep as the tree is high, so the call stack stays shallow. The benefits 
+		of the AVL are:
 		- Insert(): On average O(log N), worst case O(log N).
 		- Remove(): On average O(log N), worst case O(log N).
 		- Find(): On average O(log N), worst case O(log N).
+		- Select(): On average O(log N), worst case O(log N).
+		- Rank(): On average O(log N), worst case O(log N).
+		- LowerBound(), UpperBound(), Floor(), Ceiling(): On average O(log N), worst case O(log N).
+		- ForEachInRange(): O(log N + K), where K is the number of items in the range.
+		- Insert() of many items: O(N) if they are sorted, otherwise O(N log N) to sort them.
+		- Load(): O(N), the saved items are already sorted, so the tree is built perfectly balanced without rotations.
+		- Iterators: Each node points to its parent, so the items can be walked in order with begin() and end(), or in
+			reverse order with rbegin() and rend(), without copying them. Stepping to the next item is O(1) on average 
+			and O(log N) at worst.
 */
 
 #pragma once
 
+#include <algorithm> // Used for std::sort.
 #include <assert.h>
-#include <functional> // Used for comparison functions during Insert, Remove, and find.
+#include <cstddef> // Used for std::max_align_t.
+#include <functional> // Used for std::function.
+#include <iterator> // Used for std::bidirectional_iterator_tag and std::reverse_iterator.
+#include <type_traits> // Used to tell "lesser" comparison functions from three-way comparison functions.
+#include <utility> // Used for std::declval.
+
+#include "DynamicArray.h" // Used to gather items when many are inserted at once.
+#include "NodeAllocator.h" // Used for PoolAllocator, the default node allocator.
+#include "Snapshot.h" // Used for the file format of Save() and Load().
+#include "TreeCompare.h" // Used for LesserCompare, the default comparison function.
 /*
-	INSIGHT: Originally, I chose functors for the comparison function, because of the overhead that comes
-		with using std::function. Ultimately, I went with std::function, because writing a lambda is more
-		readable and faster to code. This makes the Binary Search Tree more convenient to use in a program.
+	INSIGHT: Originally, I went with std::function for the comparison functions, because writing a lambda is more
+		readable and faster to code. However, every comparison then goes through an indirect call that the compiler
+		cannot inline, and comparisons happen at every level of every operation. The comparison function is now a
+		template parameter, which defaults to LesserCompare. A lambda or std::function can still be used by naming its
+		type as the Compare parameter. The constructor taking a "lesser" and a "greater" std::function is kept for 
+		existing code, and LesserCompare stores the "lesser" function so those trees keep their order.
 */
 
 /*
 	DESCRIPTION: A node-based tree that keeps data in sorted order and the tree balanced.
 */
-template<typename Type>
+template<typename Type, typename Compare = LesserCompare<Type>, template<typename> class Allocator = PoolAllocator>
 class AVLTree
 {
 private:
@@ -34,16 +58,76 @@ private:
 		Type data;
 		Node* left; // Pointer to a node with data of lesser value.
 		Node* right; // Pointer to a node with data of greater value.
+		Node* parent; // Pointer to the node this node is a child of. nullptr for the root.
+		unsigned int height; // Number of levels in the subtree rooted at this node. Kept current by Rebalance().
+		unsigned int size; // Number of items in the subtree rooted at this node. Kept current by Rebalance().
 	};
 
 	// DATA MEMBERS
 
 	Node* m_root; // The head of the tree.
-	std::function<bool(const Type&, const Type&)> m_isLesser; // Function for determining lesser values.
-	std::function<bool(const Type&, const Type&)> m_isGreater; // Function for determining greater values.
+	Compare m_compare; // Function for ordering values. Either a "lesser" function or a three-way function.
+	Allocator<Node> m_allocator; // Provides the memory for each node.
+
+	// A batch of items at least this fraction of the tree is merged with it and rebuilt, instead of inserted one at a time.
+	static constexpr unsigned int REBUILD_FRACTION = 16;
+
+	// An AVL tree of 2^32 items is at most 46 levels high, so the stacks used by traversals never need more room.
+	static constexpr unsigned int MAX_HEIGHT = 64;
+
+	// TYPES
+
+	// True if the comparison function returns bool, meaning it is a "lesser" function instead of a three-way function.
+	using IsLesserCompare = std::is_same<decltype(std::declval<const Compare&>()(std::declval<const Type&>(), std::declval<const Type&>())), bool>;
+
+	// The "lesser" and "greater" functions the tree took before the comparison function was a template parameter.
+	using CompareFunction = std::function<bool(const Type&, const Type&)>;
+
+	// True if a "lesser" CompareFunction can be stored as the comparison function.
+	using IsCompareFunctionStorable = std::integral_constant<bool, std::is_constructible<Compare, const CompareFunction&>::value && IsLesserCompare::value>;
 
 	// FUNCTIONS
 
+	/*
+		DESCRIPTION: Allocates a leaf node with the allocator and constructs it.
+		PARAMETERS:
+			const Type& _data, the item the node houses.
+			Node* _parentNode, the node the new node will be a child of. nullptr if it will be the root.
+		RETURNS: (Node*) The new node.
+	*/
+	inline Node* CreateNode(const Type& _data, Node* _parentNode);
+
+	/*
+		DESCRIPTION: Destroys a node and returns its memory to the allocator.
+		PARAMETERS:
+			Node* _node, the node to destroy.
+	*/
+	inline void DestroyNode(Node* _node);
+
+	/*
+		DESCRIPTION: Determines if an item is lesser than another item with a single call to the comparison function.
+		PARAMETERS:
+			const Type& _lhs, the item on the left of the comparison.
+			const Type& _rhs, the item on the right of the comparison.
+		RETURNS: (bool) true, if _lhs is lesser than _rhs.
+	*/
+	inline bool IsLesser(const Type& _lhs, const Type& _rhs) const;
+	inline bool IsLesser(const Type& _lhs, const Type& _rhs, std::true_type) const;
+	inline bool IsLesser(const Type& _lhs, const Type& _rhs, std::false_type) const;
+
+	/*
+		DESCRIPTION: Determines the order of an item relative to another item. A three-way comparison function is 
+			called exactly once. A "lesser" comparison function is called a second time with the arguments swapped 
+			if the first call returns false.
+		PARAMETERS:
+			const Type& _lhs, the item on the left of the comparison.
+			const Type& _rhs, the item on the right of the comparison.
+		RETURNS: (int) negative if _lhs is lesser than _rhs, positive if _lhs is greater than _rhs, otherwise 0.
+	*/
+	inline int Order(const Type& _lhs, const Type& _rhs) const;
+	inline int Order(const Type& _lhs, const Type& _rhs, std::true_type) const;
+	inline int Order(const Type& _lhs, const Type& _rhs, std::false_type) const;
+
 	/*
 		DESCRIPTION: Helper function for Insert(const Type& _data). Inserts an item into the node or its children.
 		PARAMETERS:
@@ -64,66 +148,117 @@ private:
 	bool Remove(const Type& _data, Node* _node, Node* _parentNode);
 
 	/*
-		DESCRIPTION: Helper function for Find(const Type& _data). Searches for an item in the node and its children.
+		DESCRIPTION: Helper function for Clear(). Destroys a node and its children, using a stack of MAX_HEIGHT nodes 
+			instead of recursion.
 		PARAMETERS:
-			const Type& _data, the item to Find in the tree.
-			Node* _node, the node to compare data to.
-		RETURNS: (bool) true, if the item was found.
+			Node* _node, the node to Clear.
 	*/
-	bool Find(const Type& _data, Node* _node) const;
+	void Clear(Node* _node);
 
 	/*
-		DESCRIPTION: Helper function for Clear(). Clears items in a node, its children, and cleans up dynamic memory.
+		DESCRIPTION: Provides the cached height of the node.
 		PARAMETERS:
-			Node* _node, the node to Clear.
+			const Node* _node, the node to get the height of. May be nullptr.
+		RETURNS: (unsigned int), the height of the node. 0 if the node is nullptr.
 	*/
-	void Clear(Node* _node);
+	static inline unsigned int Height(const Node* _node);
 
 	/*
-		DESCRIPTION: Helper function for Size(). Provides the number of items from a given node.
+		DESCRIPTION: Provides the cached number of items in the subtree rooted at the node.
 		PARAMETERS:
-			Node* _node, the node to retrieve its Size from.
-		RETURNS: (unsigned int), count of items starting at the node.
+			const Node* _node, the node to get the size of. May be nullptr.
+		RETURNS: (unsigned int), count of items starting at the node. 0 if the node is nullptr.
 	*/
-	unsigned int Size(Node* _node) const;
+	static inline unsigned int Size(const Node* _node);
 
 	/*
-		DESCRIPTION: Determines the height of the node.
-		PARAMETERS :
-			Node * _node - The node to get the height of.
-			unsigned int _height - 0 if called outside of this functions implementation.
-		RETURNS : int - The height of the node.
+		DESCRIPTION: Recomputes the cached height and size of the node from the cached values of its children.
+		PARAMETERS:
+			Node* _node, the node to update.
 	*/
-	unsigned int Height(const Node* _node, unsigned int _height) const;
+	static inline void UpdateNode(Node* _node);
 
 	/*
-		DESCRIPTION: Helper functions for public interface "ToArray" functions. Copies the items in the node and its 
-			children to a given array using a traversal described by the function.
+		DESCRIPTION: Replaces the child node with a new node in the child's parent.
 		PARAMETERS:
-			Type& _outArray, a preallocated array to copy the tree items to.
-			int& _outArrayIndex, the index in the _outArray to write the next node value to.
-			Node* _node, the Current node we are visiting.
+			Node* _node, the child node being replaced.
+			Node* _parentNode, the parent of the child node. nullptr if the child node is the root.
+			Node* _newNode, the node taking the child's place. May be nullptr.
 	*/
-	void ToArrayInorder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
-	void ToArrayPreorder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
-	void ToArrayPostorder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
-	void ToArrayInReverseOrder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
+	void Reparent(Node* _node, Node* _parentNode, Node* _newNode);
 
 	/*
-		DESCRIPTION: Helper function for Remove(const Type& _data, Node* _node). Provides the lowest value node from 
-			a given node, removing it from the tree in the process. The lowest value node is not deleted.
+		DESCRIPTION: Provides the node with the lowest or highest value in a subtree.
+		PARAMETERS:
+			const Node* _node, the root of the subtree. May be nullptr.
+		RETURNS: (const Node*) The leftmost or rightmost node of the subtree. nullptr if the subtree is empty.
+	*/
+	static inline const Node* Minimum(const Node* _node);
+	static inline const Node* Maximum(const Node* _node);
+
+	/*
+		DESCRIPTION: Provides the node that comes after or before a node in sorted order. If the node has a child on 
+			that side, the answer is the closest node in that child's subtree. Otherwise, the parent pointers are 
+			followed up until the path turns. Walking a whole tree this way crosses each link twice.
+		PARAMETERS:
+			const Node* _node, the node to step from.
+		RETURNS: (const Node*) The next or previous node. nullptr if _node is the last or first node.
+	*/
+	static inline const Node* Next(const Node* _node);
+	static inline const Node* Previous(const Node* _node);
+
+	/*
+		DESCRIPTION: Visits the items in the tree using a traversal described by the function. A stack of MAX_HEIGHT 
+			nodes is used instead of recursion.
+		PARAMETERS:
+			Visitor _visit, a function called with each item, as a const Type&.
+	*/
+	template<typename Visitor>
+	void VisitInorder(Visitor _visit) const;
+	template<typename Visitor>
+	void VisitPreorder(Visitor _visit) const;
+	template<typename Visitor>
+	void VisitPostorder(Visitor _visit) const;
+	template<typename Visitor>
+	void VisitInReverseOrder(Visitor _visit) const;
+
+	/*
+		DESCRIPTION: Determines if items are in sorted order with one comparison per item.
+		PARAMETERS:
+			const Type* _items, the items to check.
+			unsigned int _count, the number of items.
+		RETURNS: (bool) true, if no item is lesser than the item before it.
+	*/
+	bool IsSorted(const Type* _items, unsigned int _count) const;
+
+	/*
+		DESCRIPTION: Builds a perfectly balanced subtree from sorted items. The middle item becomes the root of the 
+			subtree, and each half becomes one of its children, so no comparisons or rotations are needed.
+		PARAMETERS:
+			const Type* _items, the items in sorted order.
+			unsigned int _count, the number of items.
+		RETURNS: (Node*), the root of the subtree. nullptr if there are no items.
+	*/
+	Node* BuildBalanced(const Type* _items, unsigned int _count);
+
+	/*
+		DESCRIPTION: Helper function for Remove(const Type& _data, Node* _node, Node* _parentNode). Provides the lowest 
+			value node from a given node, removing it from the tree in the process and rebalancing the nodes along the 
+			way. The lowest value node is not deleted.
 		PARAMETERS:
 			Node* _node, the node to start looking for the lowest value to Remove.
+			Node* _parentNode, the parent of _node.
 		RETURNS: (Node*), the node with the lowest value.
 	*/
-	Node* RemovePostorderPredecessor(Node* _node);
+	Node* RemoveMin(Node* _node, Node* _parentNode);
 
 	/*
-		DESCRIPTION: Deep copies the node and its children.
+		DESCRIPTION: Deep copies a tree into this empty tree, keeping its shape and the cached heights and sizes. Each 
+			node is copied once, without comparisons or rotations, using a stack of MAX_HEIGHT nodes.
 		PARAMETERS:
-			Node* _node, the node to copy.
+			const Node* _root, the root of the tree to copy.
 	*/
-	void CopyAll(Node* _node);
+	void CopyAll(const Node* _root);
 
 	/*
 		DESCRIPTION: Rotates the child node to the left.
@@ -142,7 +277,7 @@ private:
 	void RotateRight(Node* _node, Node* _parentNode);
 
 	/*
-		DESCRIPTION: Rebalances the child node by rotating it if necessary.
+		DESCRIPTION: Updates the height and size of the child node and rebalances it by rotating it if necessary.
 		PARAMETERS :
 			Node * _node - A child node to balance.
 			Node * _parentNode - The parent of the child node.
@@ -150,22 +285,117 @@ private:
 	void Rebalance(Node* _node, Node* _parentNode);
 
 public:
+	/*
+		DESCRIPTION: A bidirectional iterator over the items of the tree in sorted order. Items cannot be changed 
+			through an iterator, since that could break the order of the tree. An iterator stays valid until the item 
+			it refers to is removed, since rotations move links but never move items between nodes. Clear(), 
+			assignment, Load(), BuildFromSorted(), and Insert() of many items rebuild the tree, which makes every 
+			iterator invalid.
+	*/
+	class Iterator
+	{
+	private:
+		// DATA MEMBERS
+
+		const Node* m_node; // The node of the current item. nullptr past the last item.
+		const AVLTree* m_tree; // The tree being walked, so that the last item can be found from the end.
+
+	public:
+		// TYPES
+
+		// Names required by std::iterator_traits, so that the iterator works with the standard algorithms.
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Type*;
+		using reference = const Type&;
+
+		// FUNCTIONS
+
+		/*
+			DESCRIPTION: Constructs an iterator that refers to no tree.
+		*/
+		Iterator() : m_node(nullptr), m_tree(nullptr) {}
+
+		/*
+			DESCRIPTION: Constructs an iterator to a node of a tree.
+			PARAMETERS:
+				const Node* _node, the node of the item. nullptr for the end of the tree.
+				const AVLTree* _tree, the tree the node is in.
+		*/
+		Iterator(const Node* _node, const AVLTree* _tree) : m_node(_node), m_tree(_tree) {}
+
+		/*
+			DESCRIPTION: Provides the current item. The iterator must not be at the end.
+			RETURNS: (const Type&) The item.
+		*/
+		inline const Type& operator*() const { return m_node->data; }
+		inline const Type* operator->() const { return &m_node->data; }
+
+		/*
+			DESCRIPTION: Steps to the next item in sorted order.
+			RETURNS: (Iterator&) This iterator, or a copy of it from before the step.
+		*/
+		inline Iterator& operator++() { m_node = Next(m_node); return *this; }
+		inline Iterator operator++(int) { Iterator iterator(*this); m_node = Next(m_node); return iterator; }
+
+		/*
+			DESCRIPTION: Steps to the previous item in sorted order. Stepping back from the end gives the last item.
+			RETURNS: (Iterator&) This iterator, or a copy of it from before the step.
+		*/
+		inline Iterator& operator--() { m_node = (m_node) ? Previous(m_node) : Maximum(m_tree->m_root); return *this; }
+		inline Iterator operator--(int) { Iterator iterator(*this); --*this; return iterator; }
+
+		/*
+			DESCRIPTION: Determines if two iterators refer to the same item.
+			PARAMETERS:
+				const Iterator& _other, the iterator to compare with.
+			RETURNS: (bool) true, if both iterators refer to the same node, or both are at the end.
+		*/
+		inline bool operator==(const Iterator& _other) const { return m_node == _other.m_node; }
+		inline bool operator!=(const Iterator& _other) const { return m_node != _other.m_node; }
+	};
+
+	// TYPES
+
+	using ReverseIterator = std::reverse_iterator<Iterator>; // Walks the items from the highest to the lowest.
+
 	// FUNCTIONS
 
 	/*
 		DESCRIPTION: Constructs an empty tree.
+		PARAMETERS:
+			const Compare& _compare, function for ordering values. Either a "lesser" function returning bool, or a
+				three-way function returning a negative, zero, or positive value, like std::string::compare().
+	*/
+	explicit AVLTree(const Compare& _compare = Compare());
+
+	/*
+		DESCRIPTION: Constructs an empty tree ordered by a "lesser" and a "greater" function. Only the "lesser" 
+			function is used, since the "greater" function is the same comparison with the arguments swapped. Compare 
+			must be a "lesser" function that can be constructed from the std::function, like the default 
+			LesserCompare or std::function<bool(const Type&, const Type&)> itself.
 		PARAMETERS:
 			std::function<bool(const Type&, const Type&)> _isLesser, function for determining lesser values.
 			std::function<bool(const Type&, const Type&)> _isGreater, function for determining greater values.
 	*/
-	AVLTree(std::function<bool(const Type&, const Type&)> _isLesser, std::function<bool(const Type&, const Type&)> _isGreater);
+	AVLTree(CompareFunction _isLesser, CompareFunction _isGreater);
+
+	/*
+		DESCRIPTION: Constructs a balanced tree from items in any order. See Insert(const Type* _items, unsigned int _count).
+		PARAMETERS:
+			const Type* _items, the items to Insert into the tree.
+			unsigned int _count, the number of items.
+			const Compare& _compare, function for ordering values.
+	*/
+	AVLTree(const Type* _items, unsigned int _count, const Compare& _compare = Compare());
 
 	/*
 		DESCRIPTION: Copy constructs a tree by performing a deep copy of the given tree.
 		PARAMETERS:
 			const AVLTree& _avlTree, a tree.
 	*/
-	AVLTree(const AVLTree<Type>& _avlTree);
+	AVLTree(const AVLTree<Type, Compare, Allocator>& _avlTree);
 
 	/*
 		DESCRIPTION: Destroys the tree and cleans up any dynamic memory.
@@ -177,7 +407,7 @@ public:
 		PARAMETERS:
 			const AVLTree& _avlTree, a tree.
 	*/
-	AVLTree<Type>& operator=(const AVLTree<Type>& _avlTree);
+	AVLTree<Type, Compare, Allocator>& operator=(const AVLTree<Type, Compare, Allocator>& _avlTree);
 
 	/*
 		DESCRIPTION: Inserts an item into the tree.
@@ -186,6 +416,26 @@ public:
 	*/
 	void Insert(const Type& _data);
 
+	/*
+		DESCRIPTION: Inserts many items into the tree. Items that are already sorted are detected with one comparison 
+			per item, and other items are copied and sorted first. If the tree is empty, or the items are at least a 
+			sixteenth of the tree, the items are merged with the items in the tree and the tree is rebuilt perfectly 
+			balanced in O(N). Otherwise, the items are inserted one at a time.
+		PARAMETERS:
+			const Type* _items, the items to Insert into the tree.
+			unsigned int _count, the number of items.
+	*/
+	void Insert(const Type* _items, unsigned int _count);
+
+	/*
+		DESCRIPTION: Replaces the items in the tree with sorted items, building a perfectly balanced tree in O(N) 
+			without comparing them.
+		PARAMETERS:
+			const Type* _items, the items in sorted order, by the comparison function of the tree.
+			unsigned int _count, the number of items.
+	*/
+	void BuildFromSorted(const Type* _items, unsigned int _count);
+
 	/*
 		DESCRIPTION: Removes an item from the tree.
 		PARAMETERS:
@@ -203,7 +453,8 @@ public:
 	bool Find(const Type& _data) const;
 
 	/*
-		DESCRIPTION: Clears all items from the tree and cleans up dynamic memory.
+		DESCRIPTION: Clears all items from the tree and cleans up dynamic memory. If Type is trivially destructible 
+			and the allocator supports it, all nodes are released at once instead of one at a time.
 	*/
 	void Clear();
 
@@ -217,7 +468,71 @@ public:
 		DESCRIPTION: Determines the height of the tree.
 		RETURNS : int - The height of the stree.
 	*/
-	unsigned int Height() const;
+	inline unsigned int Height() const;
+
+	/*
+		DESCRIPTION: Provides the item at a position in sorted order without copying the tree to an array.
+		PARAMETERS:
+			unsigned int _index, the zero-based position of the item. Must be less than Size().
+		RETURNS: (const Type&), the item at _index if the tree were copied with ToArrayInorder().
+	*/
+	const Type& Select(unsigned int _index) const;
+
+	/*
+		DESCRIPTION: Provides the number of items in the tree that are lesser than the given item.
+		PARAMETERS:
+			const Type& _data, the item to rank. It does not need to be in the tree.
+		RETURNS: (unsigned int), count of items lesser than _data.
+	*/
+	unsigned int Rank(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Provides the number of items in the tree within the range [_lowest, _highest).
+		PARAMETERS:
+			const Type& _lowest, the lowest item in the range, inclusive.
+			const Type& _highest, the highest item in the range, exclusive.
+		RETURNS: (unsigned int), count of items in the range. 0 if _highest is not greater than _lowest.
+	*/
+	unsigned int CountInRange(const Type& _lowest, const Type& _highest) const;
+
+	/*
+		DESCRIPTION: Finds the first item that is not lesser than, or the first item that is greater than, the given 
+			item. Together they give the items equal to the given item as [LowerBound(), UpperBound()).
+		PARAMETERS:
+			const Type& _data, the item to search for. It does not need to be in the tree.
+		RETURNS: (Iterator) An iterator to the item found. end() if every item is lesser than, or not greater than, 
+			_data.
+	*/
+	Iterator LowerBound(const Type& _data) const;
+	Iterator UpperBound(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Finds the highest item that is not greater than the given item.
+		PARAMETERS:
+			const Type& _data, the item to search for. It does not need to be in the tree.
+		RETURNS: (Iterator) An iterator to the last such item. end() if every item is greater than _data.
+	*/
+	Iterator Floor(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Finds the lowest item that is not lesser than the given item. The same item as LowerBound().
+		PARAMETERS:
+			const Type& _data, the item to search for. It does not need to be in the tree.
+		RETURNS: (Iterator) An iterator to the first such item. end() if every item is lesser than _data.
+	*/
+	Iterator Ceiling(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Visits the items within the range [_lowest, _highest) in sorted order. The first item is found 
+			in O(log N), and each item after it is one step of an iterator, so only the nodes in or next to the range 
+			are visited.
+		PARAMETERS:
+			const Type& _lowest, the lowest item in the range, inclusive.
+			const Type& _highest, the highest item in the range, exclusive.
+			Visitor _visit, a function called with each item in the range, as a const Type&.
+	*/
+	template<typename Visitor>
+	void ForEachInRange(const Type& _lowest, const Type& _highest, Visitor _visit) const;
 
 	/*
 		DESCRIPTION: Copies the items in the tree to a given array using a traversal described by the function.
@@ -228,31 +543,84 @@ public:
 	void ToArrayPreorder(Type* _outArray) const;
 	void ToArrayPostorder(Type* _outArray) const;
 	void ToArrayInReverseOrder(Type* _outArray) const;
+
+	/*
+		DESCRIPTION: Provides iterators for walking the items in sorted order. The names follow the standard library, 
+			so the tree can be used in a range-based for loop and with the standard algorithms. Finding the first item 
+			is O(log N).
+		RETURNS: (Iterator) An iterator to the lowest item, or past the highest item.
+	*/
+	Iterator begin() const;
+	Iterator end() const;
+
+	/*
+		DESCRIPTION: Provides iterators for walking the items in reverse sorted order.
+		RETURNS: (ReverseIterator) An iterator to the highest item, or past the lowest item.
+	*/
+	ReverseIterator rbegin() const;
+	ReverseIterator rend() const;
+
+	/*
+		DESCRIPTION: Saves the items in the tree to a snapshot file in sorted order. Type must be trivially copyable.
+		PARAMETERS:
+			const char* _path, the path of the file to write. An existing file is replaced.
+		RETURNS: (bool) true, if all of the items were written.
+	*/
+	bool Save(const char* _path) const;
+
+	/*
+		DESCRIPTION: Replaces the items in the tree with the items in a snapshot file written by Save(). The tree is 
+			built perfectly balanced in O(N). Where supported, the file is memory mapped, so the items are copied 
+			straight from the file into the nodes. Type must be trivially copyable.
+		PARAMETERS:
+			const char* _path, the path of the file to read.
+		RETURNS: (bool) true, if the items were loaded. If the file cannot be read, holds items of a different size, 
+			or its items are not sorted by the comparison function, the tree is left unchanged.
+	*/
+	bool Load(const char* _path);
 };
 
-template<typename Type>
-AVLTree<Type>::AVLTree(std::function<bool(const Type&, const Type&)> _isLesser, std::function<bool(const Type&, const Type&)> _isGreater) :
+template<typename Type, typename Compare, template<typename> class Allocator>
+AVLTree<Type, Compare, Allocator>::AVLTree(const Compare& _compare) :
+	m_root(nullptr),
+	m_compare(_compare)
+{
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+AVLTree<Type, Compare, Allocator>::AVLTree(CompareFunction _isLesser, CompareFunction _isGreater) :
+	m_root(nullptr),
+	m_compare(_isLesser)
+{
+	static_assert(IsCompareFunctionStorable::value, "Compare must be a \"lesser\" function that can be constructed from a std::function.");
+	assert(_isLesser && _isGreater);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+AVLTree<Type, Compare, Allocator>::AVLTree(const Type* _items, unsigned int _count, const Compare& _compare) :
 	m_root(nullptr),
-	m_isLesser(_isLesser),
-	m_isGreater(_isGreater)
+	m_compare(_compare)
 {
+	Insert(_items, _count);
 }
 
-template<typename Type>
-AVLTree<Type>::AVLTree(const AVLTree<Type>& _avlTree)
+template<typename Type, typename Compare, template<typename> class Allocator>
+AVLTree<Type, Compare, Allocator>::AVLTree(const AVLTree<Type, Compare, Allocator>& _avlTree) :
+	m_root(nullptr),
+	m_compare(_avlTree.m_compare)
 {
 	if (_avlTree.m_root)
 		CopyAll(_avlTree.m_root);
 }
 
-template<typename Type>
-AVLTree<Type>::~AVLTree()
+template<typename Type, typename Compare, template<typename> class Allocator>
+AVLTree<Type, Compare, Allocator>::~AVLTree()
 {
 	Clear();
 }
 
-template<typename Type>
-AVLTree<Type>& AVLTree<Type>::operator=(const AVLTree<Type>& _avlTree)
+template<typename Type, typename Compare, template<typename> class Allocator>
+AVLTree<Type, Compare, Allocator>& AVLTree<Type, Compare, Allocator>::operator=(const AVLTree<Type, Compare, Allocator>& _avlTree)
 {
 	// We don't need to do anything if we are assigning to ourself.
 	if (this == &_avlTree)
@@ -260,379 +628,762 @@ AVLTree<Type>& AVLTree<Type>::operator=(const AVLTree<Type>& _avlTree)
 
 	Clear();
 
+	m_compare = _avlTree.m_compare;
+
 	if (_avlTree.m_root)
 		CopyAll(_avlTree.m_root);
 
 	return *this;
 }
 
-template<typename Type>
-void AVLTree<Type>::Insert(const Type& _data)
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::CreateNode(const Type& _data, Node* _parentNode)
+{
+	return new (m_allocator.Allocate()) Node{ _data, nullptr, nullptr, _parentNode, 1, 1 };
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::DestroyNode(Node* _node)
+{
+	_node->~Node();
+	m_allocator.Deallocate(_node);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::IsLesser(const Type& _lhs, const Type& _rhs) const
+{
+	return IsLesser(_lhs, _rhs, IsLesserCompare());
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::IsLesser(const Type& _lhs, const Type& _rhs, std::true_type) const
+{
+	return m_compare(_lhs, _rhs);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::IsLesser(const Type& _lhs, const Type& _rhs, std::false_type) const
+{
+	return m_compare(_lhs, _rhs) < 0;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+int AVLTree<Type, Compare, Allocator>::Order(const Type& _lhs, const Type& _rhs) const
+{
+	return Order(_lhs, _rhs, IsLesserCompare());
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+int AVLTree<Type, Compare, Allocator>::Order(const Type& _lhs, const Type& _rhs, std::true_type) const
+{
+	if (m_compare(_lhs, _rhs))
+		return -1;
+
+	return (m_compare(_rhs, _lhs)) ? 1 : 0;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+int AVLTree<Type, Compare, Allocator>::Order(const Type& _lhs, const Type& _rhs, std::false_type) const
+{
+	const auto order = m_compare(_lhs, _rhs);
+
+	return (order < 0) ? -1 : ((order > 0) ? 1 : 0);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Insert(const Type& _data)
 {
 	if (!m_root)
-		m_root = new Node{ _data, nullptr, nullptr };
+		m_root = CreateNode(_data, nullptr);
 	else
 		Insert(_data, m_root, nullptr);
 }
 
-template<typename Type>
-void AVLTree<Type>::Insert(const Type& _data, Node* _node, Node* _parentNode)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Insert(const Type& _data, Node* _node, Node* _parentNode)
 {
-	if (m_isLesser(_data, _node->data))
+	if (IsLesser(_data, _node->data))
 	{
 		if (!_node->left)
-			_node->left = new Node{ _data, nullptr, nullptr }; // If no left node, add one.
+			_node->left = CreateNode(_data, _node); // If no left node, add one.
 		else
 			Insert(_data, _node->left, _node); // Otherwise, go left.
 	}
 	else if (!_node->right)
-		_node->right = new Node{ _data, nullptr, nullptr }; // If no right node, add one.
+		_node->right = CreateNode(_data, _node); // If no right node, add one.
 	else
 		Insert(_data, _node->right, _node); // Otherwise, go right.
 
 	Rebalance(_node, _parentNode);
 }
 
-template<typename Type>
-bool AVLTree<Type>::Remove(const Type& _data)
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::Remove(const Type& _data)
 {
 	return Remove(_data, m_root, nullptr);
 }
 
-template<typename Type>
-bool AVLTree<Type>::Remove(const Type& _data, Node* _node, Node* _parentNode)
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::Remove(const Type& _data, Node* _node, Node* _parentNode)
 {
 	if (!_node)
 		return false;
 
-	if (m_isLesser(_data, _node->data))
+	bool result;
+	const int order = Order(_data, _node->data);
+
+	if (order < 0)
+		result = Remove(_data, _node->left, _node); // The node to Remove may be further left.
+	else if (order > 0)
+		result = Remove(_data, _node->right, _node); // The node to Remove may be further right.
+	else
 	{
-		Node* leftNode = _node->left;
+		// Found the node. Now Remove it.
+
+		Node* newNode;
 
-		if (leftNode && leftNode->data == _data)
+		if (!_node->left)
+			newNode = _node->right; // Node has no children or a child on the right.
+		else if (!_node->right)
+			newNode = _node->left; // Node has child on the left.
+		else
 		{
-			// Found the node. Now Remove it.
-
-			if (!leftNode->left)
-			{
-				if (!leftNode->right)
-				{
-					// The node has no children.
-
-					delete leftNode;
-					_node->left = nullptr;
-				}
-				else
-				{
-					// Node has child on the right.
-
-					_node->left = leftNode->right;
-					delete leftNode;
-				}
-			}
-			else if (!leftNode->right)
-			{
-				// Node has child on the left.
-
-				_node->left = leftNode->left;
-				delete leftNode;
-			}
-			else
-			{
-				// Node has two children.
-
-				Node* minNode = RemovePostorderPredecessor(leftNode->right); // Get the minimum value node from the right child...
-				leftNode->data = minNode->data; // ... and assign its value to this node.
-
-				// If the right child is the minimum value node, then its right child needs to take its place.
-				if (leftNode->right == minNode)
-					leftNode->right = minNode->right;
-
-				delete minNode;
-			}
-
-			Rebalance(_node, _parentNode);
+			// Node has two children. The minimum value node from the right child takes its place.
 
-			return true;
+			newNode = RemoveMin(_node->right, _node);
+			newNode->left = _node->left;
+			newNode->right = _node->right;
+
+			newNode->left->parent = newNode;
+			if (newNode->right)
+				newNode->right->parent = newNode;
 		}
 
-		// The node to Remove may be further left.
-		bool result = Remove(_data, leftNode, _node);
+		Reparent(_node, _parentNode, newNode);
+		DestroyNode(_node);
+
+		if (newNode)
+			Rebalance(newNode, _parentNode);
+
+		return true;
+	}
+
+	if (result)
 		Rebalance(_node, _parentNode);
 
-		return result;
+	return result;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::Find(const Type& _data) const
+{
+	for (const Node* node = m_root; node; )
+	{
+		const int order = Order(_data, node->data);
+
+		if (order < 0)
+			node = node->left;
+		else if (order > 0)
+			node = node->right;
+		else
+			return true;
 	}
-	else if (m_isGreater(_data, _node->data))
+
+	return false;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Clear()
+{
+	// Nodes that have nothing to destroy don't need to be visited if the allocator can release them all at once.
+	if (!std::is_trivially_destructible<Type>::value || !m_allocator.ReleaseAll())
+		Clear(m_root);
+
+	m_root = nullptr;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Clear(Node* _node)
+{
+	if (!_node)
+		return;
+
+	Node* stack[MAX_HEIGHT];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = _node;
+
+	while (stackSize > 0)
 	{
-		Node* rightNode = _node->right;
+		Node* node = stack[--stackSize];
 
-		if (rightNode && rightNode->data == _data)
-		{
-			// Found the node. Now Remove it.
-
-			if (!rightNode->left)
-			{
-				if (!rightNode->right)
-				{
-					// The node has no children.
-
-					delete rightNode;
-					_node->right = nullptr;
-				}
-				else
-				{
-					// Node has child on the right.
-
-					_node->right = rightNode->right;
-					delete rightNode;
-				}
-			}
-			else if (!rightNode->right)
-			{
-				// Node has child on the left.
-
-				_node->right = rightNode->left;
-				delete rightNode;
-			}
-			else
-			{
-				// Node has two children.
-
-				Node* minNode = RemovePostorderPredecessor(rightNode->right); // Get the minimum value node from the right child...
-				rightNode->data = minNode->data; // ... and assign its value to this node.
-
-				// If the right child is the minimum value node, then its right child needs to take its place.
-				if (rightNode->right == minNode)
-					rightNode->right = minNode->right;
-
-				delete minNode;
-			}
-
-			Rebalance(_node, _parentNode);
+		// The right child is pushed first, so that nodes are destroyed from left to right.
+		if (node->right)
+			stack[stackSize++] = node->right;
 
-			return true;
-		}
+		if (node->left)
+			stack[stackSize++] = node->left;
 
-		// The node to Remove may be further right.
-		bool result = Remove(_data, rightNode, _node);
-		Rebalance(_node, _parentNode);
+		DestroyNode(node);
+	}
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int AVLTree<Type, Compare, Allocator>::Size() const
+{
+	return Size(m_root);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int AVLTree<Type, Compare, Allocator>::Height() const
+{
+	return Height(m_root);
+}
 
-		return result;;
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int AVLTree<Type, Compare, Allocator>::Height(const Node* _node)
+{
+	return (_node) ? _node->height : 0;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int AVLTree<Type, Compare, Allocator>::Size(const Node* _node)
+{
+	return (_node) ? _node->size : 0;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::UpdateNode(Node* _node)
+{
+	const unsigned int leftHeight = Height(_node->left);
+	const unsigned int rightHeight = Height(_node->right);
+
+	_node->height = ((leftHeight > rightHeight) ? leftHeight : rightHeight) + 1;
+	_node->size = Size(_node->left) + Size(_node->right) + 1;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+const Type& AVLTree<Type, Compare, Allocator>::Select(unsigned int _index) const
+{
+	assert(_index < Size());
+
+	const Node* node = m_root;
+
+	while (true)
+	{
+		const unsigned int leftSize = Size(node->left);
+
+		if (_index < leftSize)
+			node = node->left;
+		else if (_index == leftSize)
+			return node->data;
+		else
+		{
+			// Skip the left subtree and this node.
+			_index -= leftSize + 1;
+			node = node->right;
+		}
 	}
-	else if (_node->right)
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int AVLTree<Type, Compare, Allocator>::Rank(const Type& _data) const
+{
+	unsigned int rank = 0;
+
+	for (const Node* node = m_root; node; )
 	{
-		// The node to Remove is the root. It has a child on the right. It may or may not have a child on the left.
+		if (IsLesser(node->data, _data))
+		{
+			// This node and everything to its left is lesser.
+			rank += Size(node->left) + 1;
+			node = node->right;
+		}
+		else
+			node = node->left;
+	}
 
-		Node* minNode = RemovePostorderPredecessor(_node->right); // Get the minimum value node from the right child...
-		minNode->left = _node->left; // ... and point minNode's left to the left child.
+	return rank;
+}
 
-		// If the right child is not the minimum value node, then point minNode's right to the right child.
-		if (_node->right != minNode)
-			minNode->right = _node->right;
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int AVLTree<Type, Compare, Allocator>::CountInRange(const Type& _lowest, const Type& _highest) const
+{
+	if (!IsLesser(_lowest, _highest))
+		return 0;
 
-		delete _node;
-		m_root = minNode;
+	return Rank(_highest) - Rank(_lowest);
+}
 
-		Rebalance(m_root, nullptr);
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Iterator AVLTree<Type, Compare, Allocator>::LowerBound(const Type& _data) const
+{
+	const Node* boundNode = nullptr;
 
-		return true;
+	for (const Node* node = m_root; node; )
+	{
+		if (IsLesser(node->data, _data))
+			node = node->right;
+		else
+		{
+			// This node is a candidate, but a lesser one may be to its left.
+			boundNode = node;
+			node = node->left;
+		}
 	}
 
-	// The node to Remove is the root. It may or may not have a child on the left.
+	return Iterator(boundNode, this);
+}
 
-	m_root = _node->left; // This may or may not be nullptr.
-	delete _node;
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Iterator AVLTree<Type, Compare, Allocator>::UpperBound(const Type& _data) const
+{
+	const Node* boundNode = nullptr;
 
-	if (m_root)
-		Rebalance(m_root, nullptr);
+	for (const Node* node = m_root; node; )
+	{
+		if (IsLesser(_data, node->data))
+		{
+			// This node is a candidate, but a lesser one may be to its left.
+			boundNode = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
 
-	return true;
+	return Iterator(boundNode, this);
 }
 
-template<typename Type>
-bool AVLTree<Type>::Find(const Type& _data) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Iterator AVLTree<Type, Compare, Allocator>::Floor(const Type& _data) const
 {
-	return Find(_data, m_root);
+	const Node* floorNode = nullptr;
+
+	for (const Node* node = m_root; node; )
+	{
+		if (IsLesser(_data, node->data))
+			node = node->left;
+		else
+		{
+			// This node is a candidate, but a greater one may be to its right.
+			floorNode = node;
+			node = node->right;
+		}
+	}
+
+	return Iterator(floorNode, this);
 }
 
-template<typename Type>
-bool AVLTree<Type>::Find(const Type& _data, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Iterator AVLTree<Type, Compare, Allocator>::Ceiling(const Type& _data) const
 {
-	if (!_node)
-		return false;
+	return LowerBound(_data);
+}
 
-	if (m_isLesser(_data, _node->data))
-		return Find(_data, _node->left);
-	else if (m_isGreater(_data, _node->data))
-		return Find(_data, _node->right);
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void AVLTree<Type, Compare, Allocator>::ForEachInRange(const Type& _lowest, const Type& _highest, Visitor _visit) const
+{
+	const Iterator last = end();
 
-	return true;
+	for (Iterator it = LowerBound(_lowest); it != last && IsLesser(*it, _highest); ++it)
+		_visit(*it);
 }
 
-template<typename Type>
-void AVLTree<Type>::Clear()
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Reparent(Node* _node, Node* _parentNode, Node* _newNode)
 {
-	Clear(m_root);
-	m_root = nullptr;
+	if (!_parentNode)
+		m_root = _newNode;
+	else if (_parentNode->left == _node)
+		_parentNode->left = _newNode;
+	else
+		_parentNode->right = _newNode;
+
+	if (_newNode)
+		_newNode->parent = _parentNode;
 }
 
-template<typename Type>
-void AVLTree<Type>::Clear(Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::ToArrayInorder(Type* _outArray) const
 {
-	if (!_node)
-		return;
+	VisitInorder([&_outArray](const Type& _data) { *_outArray++ = _data; });
+}
 
-	Clear(_node->left);
-	Clear(_node->right);
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::ToArrayPreorder(Type* _outArray) const
+{
+	VisitPreorder([&_outArray](const Type& _data) { *_outArray++ = _data; });
+}
 
-	delete _node;
-	_node = nullptr;
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::ToArrayPostorder(Type* _outArray) const
+{
+	VisitPostorder([&_outArray](const Type& _data) { *_outArray++ = _data; });
 }
 
-template<typename Type>
-unsigned int AVLTree<Type>::Size() const
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::ToArrayInReverseOrder(Type* _outArray) const
 {
-	return Size(m_root);
+	VisitInReverseOrder([&_outArray](const Type& _data) { *_outArray++ = _data; });
 }
 
-template<typename Type>
-unsigned int AVLTree<Type>::Size(Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Iterator AVLTree<Type, Compare, Allocator>::begin() const
 {
-	if (!_node)
-		return 0;
+	return Iterator(Minimum(m_root), this);
+}
 
-	return Size(_node->left) + Size(_node->right) + 1;
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Iterator AVLTree<Type, Compare, Allocator>::end() const
+{
+	return Iterator(nullptr, this);
 }
 
-template<typename Type>
-unsigned int AVLTree<Type>::Height() const
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::ReverseIterator AVLTree<Type, Compare, Allocator>::rbegin() const
 {
-	if (!m_root)
-		return 0;
+	return ReverseIterator(end());
+}
 
-	return Height(m_root, 0);
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::ReverseIterator AVLTree<Type, Compare, Allocator>::rend() const
+{
+	return ReverseIterator(begin());
 }
 
-template<typename Type>
-unsigned int AVLTree<Type>::Height(const Node* _node, unsigned int _height) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::Minimum(const Node* _node)
 {
-	int leftHeight = (_node->left) ? Height(_node->left, _height + 1) : _height + 1;
-	int rightHeight = (_node->right) ? Height(_node->right, _height + 1) : _height + 1;
+	if (_node)
+	{
+		while (_node->left)
+			_node = _node->left;
+	}
 
-	return (leftHeight > rightHeight) ? leftHeight : rightHeight;
+	return _node;
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayInorder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::Maximum(const Node* _node)
 {
-	int arrayIndex = 0;
-	ToArrayInorder(_outArray, arrayIndex, m_root);
+	if (_node)
+	{
+		while (_node->right)
+			_node = _node->right;
+	}
+
+	return _node;
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayPreorder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::Next(const Node* _node)
 {
-	int arrayIndex = 0;
-	ToArrayPreorder(_outArray, arrayIndex, m_root);
+	if (_node->right)
+		return Minimum(_node->right);
+
+	// Go up until coming from a left child. That parent is the next node.
+	while (_node->parent && _node->parent->right == _node)
+		_node = _node->parent;
+
+	return _node->parent;
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayPostorder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::Previous(const Node* _node)
 {
-	int arrayIndex = 0;
-	ToArrayPostorder(_outArray, arrayIndex, m_root);
+	if (_node->left)
+		return Maximum(_node->left);
+
+	// Go up until coming from a right child. That parent is the previous node.
+	while (_node->parent && _node->parent->left == _node)
+		_node = _node->parent;
+
+	return _node->parent;
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayInReverseOrder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void AVLTree<Type, Compare, Allocator>::VisitInorder(Visitor _visit) const
 {
-	int arrayIndex = 0;
-	ToArrayInReverseOrder(_outArray, arrayIndex, m_root);
+	Node* stack[MAX_HEIGHT];
+	unsigned int stackSize = 0;
+	Node* node = m_root;
+
+	while (node || stackSize > 0)
+	{
+		// Go as far left as possible, remembering the nodes to come back to.
+		for (; node; node = node->left)
+			stack[stackSize++] = node;
+
+		node = stack[--stackSize];
+
+		_visit(static_cast<const Type&>(node->data));
+		node = node->right;
+	}
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayInorder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void AVLTree<Type, Compare, Allocator>::VisitPreorder(Visitor _visit) const
 {
-	if (!_node)
+	if (!m_root)
 		return;
 
-	ToArrayInorder(_outArray, _outArrayIndex, _node->left);
-	_outArray[_outArrayIndex++] = _node->data;
-	ToArrayInorder(_outArray, _outArrayIndex, _node->right);
+	Node* stack[MAX_HEIGHT];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = m_root;
+
+	while (stackSize > 0)
+	{
+		Node* node = stack[--stackSize];
+
+		_visit(static_cast<const Type&>(node->data));
+
+		// The right child is pushed first, so that the left child is visited first.
+		if (node->right)
+			stack[stackSize++] = node->right;
+
+		if (node->left)
+			stack[stackSize++] = node->left;
+	}
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayPreorder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void AVLTree<Type, Compare, Allocator>::VisitPostorder(Visitor _visit) const
 {
-	if (!_node)
-		return;
+	Node* stack[MAX_HEIGHT];
+	unsigned int stackSize = 0;
+	Node* node = m_root;
+	const Node* visitedNode = nullptr; // The last node visited, to tell if a right child has been visited yet.
+
+	while (node || stackSize > 0)
+	{
+		// Go as far left as possible, remembering the nodes to come back to.
+		for (; node; node = node->left)
+			stack[stackSize++] = node;
+
+		Node* topNode = stack[stackSize - 1];
 
-	_outArray[_outArrayIndex++] = _node->data;
-	ToArrayPreorder(_outArray, _outArrayIndex, _node->left);
-	ToArrayPreorder(_outArray, _outArrayIndex, _node->right);
+		if (topNode->right && topNode->right != visitedNode)
+			node = topNode->right; // Visit the right child before the node.
+		else
+		{
+			_visit(static_cast<const Type&>(topNode->data));
+			visitedNode = topNode;
+			--stackSize;
+		}
+	}
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayPostorder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void AVLTree<Type, Compare, Allocator>::VisitInReverseOrder(Visitor _visit) const
 {
-	if (!_node)
-		return;
+	Node* stack[MAX_HEIGHT];
+	unsigned int stackSize = 0;
+	Node* node = m_root;
+
+	while (node || stackSize > 0)
+	{
+		// Go as far right as possible, remembering the nodes to come back to.
+		for (; node; node = node->right)
+			stack[stackSize++] = node;
+
+		node = stack[--stackSize];
 
-	ToArrayPostorder(_outArray, _outArrayIndex, _node->left);
-	ToArrayPostorder(_outArray, _outArrayIndex, _node->right);
-	_outArray[_outArrayIndex++] = _node->data;
+		_visit(static_cast<const Type&>(node->data));
+		node = node->left;
+	}
 }
 
-template<typename Type>
-void AVLTree<Type>::ToArrayInReverseOrder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Insert(const Type* _items, unsigned int _count)
 {
-	if (!_node)
+	const unsigned int size = Size();
+
+	// A small batch costs less to insert one item at a time than to rebuild the whole tree around it.
+	if (_count == 0 || _count < size / REBUILD_FRACTION)
+	{
+		for (unsigned int i = 0; i < _count; ++i)
+			Insert(_items[i]);
+
+		return;
+	}
+
+	// Sort a copy of the items, unless they are already sorted.
+	DynamicArray<Type> sortedItems;
+
+	if (!IsSorted(_items, _count))
+	{
+		sortedItems.AppendRange(_items, _count);
+		std::sort(&sortedItems[0], &sortedItems[0] + _count, [this](const Type& _lhs, const Type& _rhs) { return IsLesser(_lhs, _rhs); });
+		_items = &sortedItems[0];
+	}
+
+	if (!m_root)
+	{
+		m_root = BuildBalanced(_items, _count);
 		return;
+	}
+
+	// Merge the items with the items in the tree, then rebuild the tree from the merged items.
+	DynamicArray<Type> merged;
+	merged.Reserve(size + _count);
+
+	// Items equal to an item in the tree go after it, the same place Insert() would put them.
+	const Type* itemsEnd = _items + _count;
+
+	VisitInorder([&](const Type& _data)
+	{
+		for (; _items != itemsEnd && IsLesser(*_items, _data); ++_items)
+			merged.Append(*_items);
 
-	ToArrayInReverseOrder(_outArray, _outArrayIndex, _node->right);
-	_outArray[_outArrayIndex++] = _node->data;
-	ToArrayInReverseOrder(_outArray, _outArrayIndex, _node->left);
+		merged.Append(_data);
+	});
+
+	merged.AppendRange(_items, static_cast<unsigned int>(itemsEnd - _items));
+
+	Clear();
+	m_root = BuildBalanced(&merged[0], merged.Size());
 }
 
-template<typename Type>
-typename AVLTree<Type>::Node* AVLTree<Type>::RemovePostorderPredecessor(Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::BuildFromSorted(const Type* _items, unsigned int _count)
 {
-	assert(_node);
+	assert(IsSorted(_items, _count));
 
-	Node* nodeLeft = _node->left;
+	Clear();
+	m_root = BuildBalanced(_items, _count);
+}
 
-	if (!nodeLeft)
-		return _node;
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::IsSorted(const Type* _items, unsigned int _count) const
+{
+	for (unsigned int i = 1; i < _count; ++i)
+	{
+		if (IsLesser(_items[i], _items[i - 1]))
+			return false;
+	}
+
+	return true;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::Save(const char* _path) const
+{
+	static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable types can be saved.");
+
+	SnapshotWriter writer(_path, sizeof(Type), Size());
+	VisitInorder([&writer](const Type& _data) { writer.Write(&_data, sizeof(Type)); });
+
+	return writer.Close();
+}
 
-	// Iterate to the leftmost node.
-	while (nodeLeft->left)
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool AVLTree<Type, Compare, Allocator>::Load(const char* _path)
+{
+	static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable types can be loaded.");
+	static_assert(alignof(Type) <= alignof(std::max_align_t), "Over-aligned types cannot be loaded.");
+
+	SnapshotReader reader(_path, sizeof(Type));
+	if (!reader.IsOpen())
+		return false;
+
+	const Type* items = static_cast<const Type*>(reader.Items());
+	const unsigned int count = reader.Count();
+
+	// Building the tree trusts the order of the items, so check it first.
+	if (!IsSorted(items, count))
+		return false;
+
+	Clear();
+	m_root = BuildBalanced(items, count);
+
+	return true;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::BuildBalanced(const Type* _items, unsigned int _count)
+{
+	if (_count == 0)
+		return nullptr;
+
+	// The halves differ in size by at most one, so the heights of the children do too.
+	const unsigned int middle = _count / 2;
+
+	Node* node = CreateNode(_items[middle], nullptr);
+	node->left = BuildBalanced(_items, middle);
+	node->right = BuildBalanced(_items + middle + 1, _count - middle - 1);
+
+	if (node->left)
+		node->left->parent = node;
+
+	if (node->right)
+		node->right->parent = node;
+
+	UpdateNode(node);
+
+	return node;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename AVLTree<Type, Compare, Allocator>::Node* AVLTree<Type, Compare, Allocator>::RemoveMin(Node* _node, Node* _parentNode)
+{
+	assert(_node);
+
+	if (!_node->left)
 	{
-		_node = nodeLeft;
-		nodeLeft = nodeLeft->left;
+		// This node is the minimum value node. Its right child takes its place.
+		Reparent(_node, _parentNode, _node->right);
+		return _node;
 	}
 
-	// If nodeLeft has a child on the right, reparent the child, so it takes the place of nodeLeft.
-	if (nodeLeft->right)
-		_node->left = nodeLeft->right;
-	else // nodeLeft has no children.
-		_node->left = NULL;
+	Node* minNode = RemoveMin(_node->left, _node);
+	Rebalance(_node, _parentNode);
 
-	return nodeLeft;
+	return minNode;
 }
 
-template<typename Type>
-void AVLTree<Type>::CopyAll(Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::CopyAll(const Node* _root)
 {
-	if (!_node)
+	if (!_root)
 		return;
 
-	CopyAll(_node->left);
-	CopyAll(_node->right);
-	Insert(_node->data);
+	// A node to copy, the link in this tree that its copy goes in, and the node that link belongs to.
+	struct Copy
+	{
+		const Node* node;
+		Node** link;
+		Node* parent;
+	};
+
+	Copy stack[MAX_HEIGHT];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = Copy{ _root, &m_root, nullptr };
+
+	while (stackSize > 0)
+	{
+		const Copy copy = stack[--stackSize];
+
+		Node* node = CreateNode(copy.node->data, copy.parent);
+		node->height = copy.node->height;
+		node->size = copy.node->size;
+		*copy.link = node;
+
+		// The right child is pushed first, so that the left child is copied first.
+		if (copy.node->right)
+			stack[stackSize++] = Copy{ copy.node->right, &node->right, node };
+
+		if (copy.node->left)
+			stack[stackSize++] = Copy{ copy.node->left, &node->left, node };
+	}
 }
 
-template<typename Type>
-void AVLTree<Type>::RotateLeft(Node* _node, Node* _parentNode)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::RotateLeft(Node* _node, Node* _parentNode)
 {
 	assert(_node);
 
@@ -651,17 +1402,21 @@ void AVLTree<Type>::RotateLeft(Node* _node, Node* _parentNode)
 	_node->right = c->left;
 	c->left = _node;
 
+	if (_node->right)
+		_node->right->parent = _node;
+
+	_node->parent = c;
+
+	// a is now below c, so its height must be updated first.
+	UpdateNode(_node);
+	UpdateNode(c);
+
 	// Connect c to the parent where node was.
-	if (!_parentNode)
-		m_root = c;
-	else if (_parentNode->left == _node)
-		_parentNode->left = c;
-	else
-		_parentNode->right = c;
+	Reparent(_node, _parentNode, c);
 }
 
-template<typename Type>
-void AVLTree<Type>::RotateRight(Node* _node, Node* _parentNode)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::RotateRight(Node* _node, Node* _parentNode)
 {
 	assert(_node);
 
@@ -680,29 +1435,34 @@ void AVLTree<Type>::RotateRight(Node* _node, Node* _parentNode)
 	_node->left = x->right;
 	x->right = _node;
 
+	if (_node->left)
+		_node->left->parent = _node;
+
+	_node->parent = x;
+
+	// z is now below x, so its height must be updated first.
+	UpdateNode(_node);
+	UpdateNode(x);
+
 	// Connect x to the parent where node was.
-	if (!_parentNode)
-		m_root = x;
-	else if (_parentNode->left == _node)
-		_parentNode->left = x;
-	else
-		_parentNode->right = x;
+	Reparent(_node, _parentNode, x);
 }
 
-template<typename Type>
-void AVLTree<Type>::Rebalance(Node* _node, Node* _parentNode)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void AVLTree<Type, Compare, Allocator>::Rebalance(Node* _node, Node* _parentNode)
 {
 	assert(_node);
 
-	const int leftHeight = (_node->left) ? Height(_node->left, 0) : 0;
-	const int rightHeight = (_node->right) ? Height(_node->right, 0) : 0;
-	const int balance = leftHeight - rightHeight;
+	UpdateNode(_node);
+
+	// The children's heights are cached, so this is O(1) instead of walking both subtrees.
+	const int balance = static_cast<int>(Height(_node->left)) - static_cast<int>(Height(_node->right));
 
 	if (balance < -1) // Is tree is taller on the right?
 	{
 		assert(_node->right);
 
-		if (_node->right->left) // Right left case.
+		if (Height(_node->right->left) > Height(_node->right->right)) // Right left case.
 		{
 			RotateRight(_node->right, _node);
 			RotateLeft(_node, _parentNode);
@@ -714,7 +1474,7 @@ void AVLTree<Type>::Rebalance(Node* _node, Node* _parentNode)
 	{
 		assert(_node->left);
 
-		if (_node->left->right) // Left right case.
+		if (Height(_node->left->right) > Height(_node->left->left)) // Left right case.
 		{
 			RotateLeft(_node->left, _node);
 			RotateRight(_node, _parentNode);
@@ -0,0 +1,238 @@
+/*
+	FILE: ArrayAllocator.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Allocators for contiguous data structures. An allocator hands out uninitialized memory for an array
+		of items. The data structure constructs and destroys the items in that memory. Allocators are stateless, so
+		memory allocated by one can be deallocated by another of the same type. The allocators are:
+		- HeapArrayAllocator: Memory comes from the global heap, aligned for the type.
+		- AlignedArrayAllocator: Memory is aligned to a boundary, such as a cache line or a SIMD register.
+		- HugePageArrayAllocator: Large arrays are mapped straight from the operating system on huge page
+			boundaries and marked for transparent huge pages, so that one TLB entry covers 2 MB instead of 4 KB.
+			Small arrays are aligned like AlignedArrayAllocator. Huge pages are only requested on Linux, other
+			systems fall back to aligned memory.
+*/
+
+#pragma once
+
+#include <cstddef> // Used for std::max_align_t and size_t.
+#include <cstdint> // Used for uintptr_t.
+#include <new> // Used for ::operator new, ::operator delete, and std::bad_alloc.
+#include <stdlib.h> // Used for posix_memalign, free, _aligned_malloc, and _aligned_free.
+
+#if defined(__linux__)
+	#include <sys/mman.h> // Used for mmap, munmap, and madvise.
+#endif
+
+/*
+	DESCRIPTION: Allocates arrays from the global heap.
+*/
+template<typename Type>
+class HeapArrayAllocator
+{
+public:
+	static_assert(alignof(Type) <= alignof(std::max_align_t), "HeapArrayAllocator does not support over-aligned types.");
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates memory for an array of items. The items are not constructed.
+		PARAMETERS:
+			unsigned int _count, the number of items. Must not be zero.
+		RETURNS: (Type*) Uninitialized memory for the items.
+	*/
+	inline Type* Allocate(unsigned int _count);
+
+	/*
+		DESCRIPTION: Returns the memory for an array to the global heap. The items must already be destroyed.
+		PARAMETERS:
+			Type* _items, memory returned by Allocate().
+			unsigned int _count, the number of items passed to Allocate().
+	*/
+	inline void Deallocate(Type* _items, unsigned int _count);
+};
+
+/*
+	DESCRIPTION: Allocates arrays aligned to a boundary of Alignment bytes.
+*/
+template<typename Type, size_t Alignment>
+class AlignedArrayAllocator
+{
+public:
+	static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two.");
+	static_assert(Alignment >= alignof(Type), "The alignment must be at least the alignment of the type.");
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates aligned memory for an array of items. The items are not constructed.
+		PARAMETERS:
+			unsigned int _count, the number of items. Must not be zero.
+		RETURNS: (Type*) Uninitialized memory for the items.
+	*/
+	inline Type* Allocate(unsigned int _count);
+
+	/*
+		DESCRIPTION: Returns the memory for an array to the global heap. The items must already be destroyed.
+		PARAMETERS:
+			Type* _items, memory returned by Allocate().
+			unsigned int _count, the number of items passed to Allocate().
+	*/
+	inline void Deallocate(Type* _items, unsigned int _count);
+};
+
+/*
+	DESCRIPTION: Allocates arrays of at least Threshold bytes on huge pages, and smaller arrays aligned to a
+		boundary of Alignment bytes.
+*/
+template<typename Type, size_t Alignment, size_t Threshold>
+class HugePageArrayAllocator
+{
+private:
+	// DATA MEMBERS
+
+	static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024; // The size of a huge page on x86-64 and ARM64.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Returns the number of bytes mapped for an array, rounded up to a whole number of huge pages.
+		PARAMETERS:
+			unsigned int _count, the number of items.
+		RETURNS: (size_t) The number of bytes.
+	*/
+	static inline size_t MappedSize(unsigned int _count);
+
+public:
+	static_assert(Alignment <= HUGE_PAGE_SIZE, "Huge pages cannot be aligned to more than their size.");
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates memory for an array of items. The items are not constructed.
+		PARAMETERS:
+			unsigned int _count, the number of items. Must not be zero.
+		RETURNS: (Type*) Uninitialized memory for the items.
+	*/
+	inline Type* Allocate(unsigned int _count);
+
+	/*
+		DESCRIPTION: Returns the memory for an array to the global heap or the operating system. The items must
+			already be destroyed.
+		PARAMETERS:
+			Type* _items, memory returned by Allocate().
+			unsigned int _count, the number of items passed to Allocate().
+	*/
+	inline void Deallocate(Type* _items, unsigned int _count);
+};
+
+/*
+	DESCRIPTION: Allocates arrays aligned to a 64 byte cache line, which also suits AVX and AVX-512 loads.
+*/
+template<typename Type>
+using CacheAlignedArrayAllocator = AlignedArrayAllocator<Type, 64>;
+
+/*
+	DESCRIPTION: Allocates arrays of 2 MB or more on huge pages, and smaller arrays aligned to a 64 byte cache line.
+*/
+template<typename Type>
+using HugePageAllocator = HugePageArrayAllocator<Type, 64, 2 * 1024 * 1024>;
+
+template<typename Type>
+Type* HeapArrayAllocator<Type>::Allocate(unsigned int _count)
+{
+	return static_cast<Type*>(::operator new(sizeof(Type) * static_cast<size_t>(_count)));
+}
+
+template<typename Type>
+void HeapArrayAllocator<Type>::Deallocate(Type* _items, unsigned int)
+{
+	::operator delete(_items);
+}
+
+template<typename Type, size_t Alignment>
+Type* AlignedArrayAllocator<Type, Alignment>::Allocate(unsigned int _count)
+{
+	const size_t size = sizeof(Type) * static_cast<size_t>(_count);
+
+#if defined(_WIN32)
+	void* items = _aligned_malloc(size, Alignment);
+#else
+	// posix_memalign needs an alignment of at least the size of a pointer.
+	void* items = nullptr;
+	if (posix_memalign(&items, (Alignment < sizeof(void*)) ? sizeof(void*) : Alignment, size) != 0)
+		items = nullptr;
+#endif
+
+	if (!items)
+		throw std::bad_alloc();
+
+	return static_cast<Type*>(items);
+}
+
+template<typename Type, size_t Alignment>
+void AlignedArrayAllocator<Type, Alignment>::Deallocate(Type* _items, unsigned int)
+{
+#if defined(_WIN32)
+	_aligned_free(_items);
+#else
+	free(_items);
+#endif
+}
+
+template<typename Type, size_t Alignment, size_t Threshold>
+size_t HugePageArrayAllocator<Type, Alignment, Threshold>::MappedSize(unsigned int _count)
+{
+	const size_t size = sizeof(Type) * static_cast<size_t>(_count);
+	return (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+}
+
+template<typename Type, size_t Alignment, size_t Threshold>
+Type* HugePageArrayAllocator<Type, Alignment, Threshold>::Allocate(unsigned int _count)
+{
+#if defined(__linux__)
+	if (sizeof(Type) * static_cast<size_t>(_count) >= Threshold)
+	{
+		const size_t size = MappedSize(_count);
+
+		// Map an extra huge page so that a huge page boundary can be found inside the mapping.
+		void* mapping = mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapping == MAP_FAILED)
+			throw std::bad_alloc();
+
+		// Unmap the memory before the boundary and after the array.
+		uintptr_t start = reinterpret_cast<uintptr_t>(mapping);
+		uintptr_t alignedStart = (start + HUGE_PAGE_SIZE - 1) & ~static_cast<uintptr_t>(HUGE_PAGE_SIZE - 1);
+		size_t headSize = alignedStart - start;
+
+		if (headSize > 0)
+			munmap(mapping, headSize);
+
+		munmap(reinterpret_cast<void*>(alignedStart + size), HUGE_PAGE_SIZE - headSize);
+
+		// Only a hint, the memory still works if the system has no huge pages to give.
+#if defined(MADV_HUGEPAGE)
+		madvise(reinterpret_cast<void*>(alignedStart), size, MADV_HUGEPAGE);
+#endif
+
+		return reinterpret_cast<Type*>(alignedStart);
+	}
+#endif
+
+	return AlignedArrayAllocator<Type, Alignment>().Allocate(_count);
+}
+
+template<typename Type, size_t Alignment, size_t Threshold>
+void HugePageArrayAllocator<Type, Alignment, Threshold>::Deallocate(Type* _items, unsigned int _count)
+{
+#if defined(__linux__)
+	if (sizeof(Type) * static_cast<size_t>(_count) >= Threshold)
+	{
+		munmap(_items, MappedSize(_count));
+		return;
+	}
+#endif
+
+	AlignedArrayAllocator<Type, Alignment>().Deallocate(_items, _count);
+}
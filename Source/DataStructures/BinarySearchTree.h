@@ -2,27 +2,46 @@
 	FILE: BinarySearchTree.h
 	AUTHOR: Ozzie Mercado
 	CREATED: December 19, 2020
-	MODIFIED: January 29, 2021
-	DESCRIPTION: A templated Binary Search Tree (BST) data structure. The benefits of the BST are:
+	MODIFIED: October 16, 2026
+	DESCRIPTION: A templated Binary Search Tree (BST) data structure. Every operation is iterative, so a tree as deep 
+		as it is large, such as one built by inserting sorted items, cannot overflow the call stack. The benefits of 
+		the BST are:
 		- Insert(): On average O(log N), worst case O(N).
 		- Remove(): On average O(log N), worst case O(N).
 		- Find(): On average O(log N), worst case O(N).
+		- Insert() of many items: O(N) if they are sorted, otherwise O(N log N) to sort them.
+		- Load(): O(N), the saved items are already sorted, so the tree is built perfectly balanced.
+		- Iterators: Each node points to its parent, so the items can be walked in order with begin() and end(), or in
+			reverse order with rbegin() and rend(), without copying them. Stepping to the next item is O(1) on average.
 */
 
 #pragma once
 
+#include <algorithm> // Used for std::sort.
 #include <assert.h>
-#include <functional> // Used for comparison functions during Insert, Remove, and find. 
+#include <cstddef> // Used for std::max_align_t.
+#include <functional> // Used for std::function.
+#include <iterator> // Used for std::bidirectional_iterator_tag and std::reverse_iterator.
+#include <type_traits> // Used to tell "lesser" comparison functions from three-way comparison functions.
+#include <utility> // Used for std::declval.
+
+#include "DynamicArray.h" // Used to gather items when many are inserted at once.
+#include "NodeAllocator.h" // Used for PoolAllocator, the default node allocator.
+#include "Snapshot.h" // Used for the file format of Save() and Load().
+#include "TreeCompare.h" // Used for LesserCompare, the default comparison function.
 /*
-	INSIGHT: Originally, I chose functors for the comparison function, because of the overhead that comes
-		with using std::function. Ultimately, I went with std::function, because writing a lambda is more
-		readable and faster to code. This makes the Binary Search Tree more convenient to use in a program.
+	INSIGHT: Originally, I went with std::function for the comparison functions, because writing a lambda is more
+		readable and faster to code. However, every comparison then goes through an indirect call that the compiler
+		cannot inline, and comparisons happen at every level of every operation. The comparison function is now a
+		template parameter, which defaults to LesserCompare. A lambda or std::function can still be used by naming its
+		type as the Compare parameter. The constructor taking a "lesser" and a "greater" std::function is kept for 
+		existing code, and LesserCompare stores the "lesser" function so those trees keep their order.
 */
 
 /*
 	DESCRIPTION: A node-based binary search tree that keeps data in sorted order.
 */
-template<typename Type>
+template<typename Type, typename Compare = LesserCompare<Type>, template<typename> class Allocator = PoolAllocator>
 class BinarySearchTree
 {
 private:
@@ -34,103 +53,276 @@ private:
 		Type data;
 		Node* left; // Pointer to a node with data of lesser value.
 		Node* right; // Pointer to a node with data of greater value.
+		Node* parent; // Pointer to the node this node is a child of. nullptr for the root.
 	};
 
 	// DATA MEMBERS
 
 	Node* m_root; // The head of the tree.
-	std::function<bool(const Type&, const Type&)> m_isLesser; // Function for determining lesser values.
-	std::function<bool(const Type&, const Type&)> m_isGreater; // Function for determining greater values.
+	unsigned int m_size; // The number of items in the tree.
+	Compare m_compare; // Function for ordering values. Either a "lesser" function or a three-way function.
+	Allocator<Node> m_allocator; // Provides the memory for each node.
+
+	// A batch of items at least this fraction of the tree is merged with it and rebuilt, instead of inserted one at a time.
+	static constexpr unsigned int REBUILD_FRACTION = 16;
+
+	// TYPES
+
+	// True if the comparison function returns bool, meaning it is a "lesser" function instead of a three-way function.
+	using IsLesserCompare = std::is_same<decltype(std::declval<const Compare&>()(std::declval<const Type&>(), std::declval<const Type&>())), bool>;
+
+	// The "lesser" and "greater" functions the tree took before the comparison function was a template parameter.
+	using CompareFunction = std::function<bool(const Type&, const Type&)>;
+
+	// True if a "lesser" CompareFunction can be stored as the comparison function.
+	using IsCompareFunctionStorable = std::integral_constant<bool, std::is_constructible<Compare, const CompareFunction&>::value && IsLesserCompare::value>;
+
+	// The nodes left to visit during a traversal. Trees up to 64 levels deep need no memory from the heap.
+	using NodeStack = DynamicArray<Node*, 64>;
 
 	// FUNCTIONS
 
 	/*
-		DESCRIPTION: Helper function for Insert(const Type& _data). Inserts an item into the node or its children.
+		DESCRIPTION: Allocates a leaf node with the allocator and constructs it.
 		PARAMETERS:
-			const Type& _data, the item to Insert into the tree.
-			Node* _node, the node to compare data to for insertion.
+			const Type& _data, the item the node houses.
+			Node* _parentNode, the node the new node will be a child of. nullptr if it will be the root.
+		RETURNS: (Node*) The new node.
 	*/
-	void Insert(const Type& _data, Node* _node);
+	inline Node* CreateNode(const Type& _data, Node* _parentNode);
 
 	/*
-		DESCRIPTION: Helper function for Remove(const Type& _data). Removes an item from the node or its children.
+		DESCRIPTION: Destroys a node and returns its memory to the allocator.
 		PARAMETERS:
-			const Type& _data, the item to Remove from the tree.
-			Node* _node, the node to compare data to for removal.
-		RETURNS: (bool) true, if the item was removed.
+			Node* _node, the node to destroy.
 	*/
-	bool Remove(const Type& _data, Node* _node);
+	inline void DestroyNode(Node* _node);
 
 	/*
-		DESCRIPTION: Helper function for Find(const Type& _data). Searches for an item in the node and its children.
+		DESCRIPTION: Determines if an item is lesser than another item with a single call to the comparison function.
 		PARAMETERS:
-			const Type& _data, the item to Find in the tree.
-			Node* _node, the node to compare data to.
-		RETURNS: (bool) true, if the item was found.
+			const Type& _lhs, the item on the left of the comparison.
+			const Type& _rhs, the item on the right of the comparison.
+		RETURNS: (bool) true, if _lhs is lesser than _rhs.
+	*/
+	inline bool IsLesser(const Type& _lhs, const Type& _rhs) const;
+	inline bool IsLesser(const Type& _lhs, const Type& _rhs, std::true_type) const;
+	inline bool IsLesser(const Type& _lhs, const Type& _rhs, std::false_type) const;
+
+	/*
+		DESCRIPTION: Determines the order of an item relative to another item. A three-way comparison function is 
+			called exactly once. A "lesser" comparison function is called a second time with the arguments swapped 
+			if the first call returns false.
+		PARAMETERS:
+			const Type& _lhs, the item on the left of the comparison.
+			const Type& _rhs, the item on the right of the comparison.
+		RETURNS: (int) negative if _lhs is lesser than _rhs, positive if _lhs is greater than _rhs, otherwise 0.
 	*/
-	bool Find(const Type& _data, Node* _node) const;
+	inline int Order(const Type& _lhs, const Type& _rhs) const;
+	inline int Order(const Type& _lhs, const Type& _rhs, std::true_type) const;
+	inline int Order(const Type& _lhs, const Type& _rhs, std::false_type) const;
 
 	/*
-		DESCRIPTION: Helper function for Clear(). Clears items in a node, its children, and cleans up dynamic memory.
+		DESCRIPTION: Helper function for Clear(). Destroys a node and its children. Each left child is rotated up until 
+			the node has none, which turns the tree into a list down the right children that is destroyed in order. 
+			Each node is rotated at most once, and no stack is needed.
 		PARAMETERS:
 			Node* _node, the node to Clear.
 	*/
 	void Clear(Node* _node);
 
 	/*
-		DESCRIPTION: Helper function for Size(). Provides the number of items from a given node.
+		DESCRIPTION: Provides the node with the lowest or highest value in a subtree.
 		PARAMETERS:
-			Node* _node, the node to retrieve its Size from.
-		RETURNS: (unsigned int), count of items starting at the node.
+			const Node* _node, the root of the subtree. May be nullptr.
+		RETURNS: (const Node*) The leftmost or rightmost node of the subtree. nullptr if the subtree is empty.
 	*/
-	unsigned int Size(Node* _node) const;
+	static inline const Node* Minimum(const Node* _node);
+	static inline const Node* Maximum(const Node* _node);
 
 	/*
-		DESCRIPTION: Helper functions for public interface "ToArray" functions. Copies the items in the node and its 
-			children to a given array using a traversal described by the function.
+		DESCRIPTION: Provides the node that comes after or before a node in sorted order. If the node has a child on 
+			that side, the answer is the closest node in that child's subtree. Otherwise, the parent pointers are 
+			followed up until the path turns. Walking a whole tree this way crosses each link twice.
 		PARAMETERS:
-			Type& _outArray, a preallocated array to copy the tree items to.
-			int& _outArrayIndex, the index in the _outArray to write the next node value to.
-			Node* _node, the Current node we are visiting.
+			const Node* _node, the node to step from.
+		RETURNS: (const Node*) The next or previous node. nullptr if _node is the last or first node.
 	*/
-	void ToArrayInorder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
-	void ToArrayPreorder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
-	void ToArrayPostorder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
-	void ToArrayInReverseOrder(Type* _outArray, int& _outArrayIndex, Node* _node) const;
+	static inline const Node* Next(const Node* _node);
+	static inline const Node* Previous(const Node* _node);
 
 	/*
-		DESCRIPTION: Helper function for Remove(const Type& _data, Node* _node). Provides the lowest value node from 
-			a given node, removing it from the tree in the process. The lowest value node is not deleted.
+		DESCRIPTION: Visits the items in the tree using a traversal described by the function. An explicit stack is 
+			used instead of recursion.
+		PARAMETERS:
+			Visitor _visit, a function called with each item, as a const Type&.
+	*/
+	template<typename Visitor>
+	void VisitInorder(Visitor _visit) const;
+	template<typename Visitor>
+	void VisitPreorder(Visitor _visit) const;
+	template<typename Visitor>
+	void VisitPostorder(Visitor _visit) const;
+	template<typename Visitor>
+	void VisitInReverseOrder(Visitor _visit) const;
+
+	/*
+		DESCRIPTION: Determines if items are in sorted order with one comparison per item.
+		PARAMETERS:
+			const Type* _items, the items to check.
+			unsigned int _count, the number of items.
+		RETURNS: (bool) true, if no item is lesser than the item before it.
+	*/
+	bool IsSorted(const Type* _items, unsigned int _count) const;
+
+	/*
+		DESCRIPTION: Builds a perfectly balanced subtree from sorted items. The middle item becomes the root of the 
+			subtree, and each half becomes one of its children, so no comparisons are needed.
+		PARAMETERS:
+			const Type* _items, the items in sorted order.
+			unsigned int _count, the number of items.
+		RETURNS: (Node*), the root of the subtree. nullptr if there are no items.
+	*/
+	Node* BuildBalanced(const Type* _items, unsigned int _count);
+
+	/*
+		DESCRIPTION: Helper function for Remove(const Type& _data). Provides the lowest value node from a given node, 
+			removing it from the tree in the process. The lowest value node is not deleted.
 		PARAMETERS:
 			Node* _node, the node to start looking for the lowest value to Remove.
+			Node* _parentNode, the parent of _node.
 		RETURNS: (Node*), the node with the lowest value.
 	*/
-	Node* RemoveMin(Node* _node);
+	Node* RemoveMin(Node* _node, Node* _parentNode);
+
+	/*
+		DESCRIPTION: Replaces the child node with a new node in the child's parent.
+		PARAMETERS:
+			Node* _node, the child node being replaced.
+			Node* _parentNode, the parent of the child node. nullptr if the child node is the root.
+			Node* _newNode, the node taking the child's place. May be nullptr.
+	*/
+	void Reparent(Node* _node, Node* _parentNode, Node* _newNode);
 
 	/*
-		DESCRIPTION: Deep copies the node and its children.
+		DESCRIPTION: Deep copies a tree into this empty tree, keeping its shape. Each node is copied once, without 
+			comparisons.
 		PARAMETERS:
-			Node* _node, the node to copy.
+			const Node* _root, the root of the tree to copy.
 	*/
-	void CopyAll(Node* _node);
+	void CopyAll(const Node* _root);
 
 public:
+	/*
+		DESCRIPTION: A bidirectional iterator over the items of the tree in sorted order. Items cannot be changed 
+			through an iterator, since that could break the order of the tree. An iterator stays valid until the item 
+			it refers to is removed. Clear(), assignment, Load(), BuildFromSorted(), and Insert() of many items rebuild 
+			the tree, which makes every iterator invalid.
+	*/
+	class Iterator
+	{
+	private:
+		// DATA MEMBERS
+
+		const Node* m_node; // The node of the current item. nullptr past the last item.
+		const BinarySearchTree* m_tree; // The tree being walked, so that the last item can be found from the end.
+
+	public:
+		// TYPES
+
+		// Names required by std::iterator_traits, so that the iterator works with the standard algorithms.
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Type*;
+		using reference = const Type&;
+
+		// FUNCTIONS
+
+		/*
+			DESCRIPTION: Constructs an iterator that refers to no tree.
+		*/
+		Iterator() : m_node(nullptr), m_tree(nullptr) {}
+
+		/*
+			DESCRIPTION: Constructs an iterator to a node of a tree.
+			PARAMETERS:
+				const Node* _node, the node of the item. nullptr for the end of the tree.
+				const BinarySearchTree* _tree, the tree the node is in.
+		*/
+		Iterator(const Node* _node, const BinarySearchTree* _tree) : m_node(_node), m_tree(_tree) {}
+
+		/*
+			DESCRIPTION: Provides the current item. The iterator must not be at the end.
+			RETURNS: (const Type&) The item.
+		*/
+		inline const Type& operator*() const { return m_node->data; }
+		inline const Type* operator->() const { return &m_node->data; }
+
+		/*
+			DESCRIPTION: Steps to the next item in sorted order.
+			RETURNS: (Iterator&) This iterator, or a copy of it from before the step.
+		*/
+		inline Iterator& operator++() { m_node = Next(m_node); return *this; }
+		inline Iterator operator++(int) { Iterator iterator(*this); m_node = Next(m_node); return iterator; }
+
+		/*
+			DESCRIPTION: Steps to the previous item in sorted order. Stepping back from the end gives the last item.
+			RETURNS: (Iterator&) This iterator, or a copy of it from before the step.
+		*/
+		inline Iterator& operator--() { m_node = (m_node) ? Previous(m_node) : Maximum(m_tree->m_root); return *this; }
+		inline Iterator operator--(int) { Iterator iterator(*this); --*this; return iterator; }
+
+		/*
+			DESCRIPTION: Determines if two iterators refer to the same item.
+			PARAMETERS:
+				const Iterator& _other, the iterator to compare with.
+			RETURNS: (bool) true, if both iterators refer to the same node, or both are at the end.
+		*/
+		inline bool operator==(const Iterator& _other) const { return m_node == _other.m_node; }
+		inline bool operator!=(const Iterator& _other) const { return m_node != _other.m_node; }
+	};
+
+	// TYPES
+
+	using ReverseIterator = std::reverse_iterator<Iterator>; // Walks the items from the highest to the lowest.
+
 	// FUNCTIONS
 
 	/*
 		DESCRIPTION: Constructs an empty binary search tree.
+		PARAMETERS:
+			const Compare& _compare, function for ordering values. Either a "lesser" function returning bool, or a
+				three-way function returning a negative, zero, or positive value, like std::string::compare().
+	*/
+	explicit BinarySearchTree(const Compare& _compare = Compare());
+
+	/*
+		DESCRIPTION: Constructs an empty tree ordered by a "lesser" and a "greater" function. Only the "lesser" 
+			function is used, since the "greater" function is the same comparison with the arguments swapped. Compare 
+			must be a "lesser" function that can be constructed from the std::function, like the default 
+			LesserCompare or std::function<bool(const Type&, const Type&)> itself.
 		PARAMETERS:
 			std::function<bool(const Type&, const Type&)> _isLesser, function for determining lesser values.
 			std::function<bool(const Type&, const Type&)> _isGreater, function for determining greater values.
 	*/
-	BinarySearchTree(std::function<bool(const Type&, const Type&)> _isLesser, std::function<bool(const Type&, const Type&)> _isGreater);
+	BinarySearchTree(CompareFunction _isLesser, CompareFunction _isGreater);
+
+	/*
+		DESCRIPTION: Constructs a balanced tree from items in any order. See Insert(const Type* _items, unsigned int _count).
+		PARAMETERS:
+			const Type* _items, the items to Insert into the tree.
+			unsigned int _count, the number of items.
+			const Compare& _compare, function for ordering values.
+	*/
+	BinarySearchTree(const Type* _items, unsigned int _count, const Compare& _compare = Compare());
 
 	/*
 		DESCRIPTION: Copy constructs a tree by performing a deep copy of the given BST.
 		PARAMETERS:
 			const BinarySearchTree& _bst, a binary search tree.
 	*/
-	BinarySearchTree(const BinarySearchTree<Type>& _bst);
+	BinarySearchTree(const BinarySearchTree<Type, Compare, Allocator>& _bst);
 
 	/*
 		DESCRIPTION: Destroys the binary search tree and cleans up any dynamic memory.
@@ -142,7 +334,7 @@ public:
 		PARAMETERS:
 			const BinarySearchTree& _bst, a binary search tree.
 	*/
-	BinarySearchTree<Type>& operator=(const BinarySearchTree<Type>& _bst);
+	BinarySearchTree<Type, Compare, Allocator>& operator=(const BinarySearchTree<Type, Compare, Allocator>& _bst);
 
 	/*
 		DESCRIPTION: Inserts an item into the tree.
@@ -151,6 +343,26 @@ public:
 	*/
 	void Insert(const Type& _data);
 
+	/*
+		DESCRIPTION: Inserts many items into the tree. Items that are already sorted are detected with one comparison 
+			per item, and other items are copied and sorted first. If the tree is empty, or the items are at least a 
+			sixteenth of the tree, the items are merged with the items in the tree and the tree is rebuilt perfectly 
+			balanced in O(N). Otherwise, the items are inserted one at a time.
+		PARAMETERS:
+			const Type* _items, the items to Insert into the tree.
+			unsigned int _count, the number of items.
+	*/
+	void Insert(const Type* _items, unsigned int _count);
+
+	/*
+		DESCRIPTION: Replaces the items in the tree with sorted items, building a perfectly balanced tree in O(N) 
+			without comparing them.
+		PARAMETERS:
+			const Type* _items, the items in sorted order, by the comparison function of the tree.
+			unsigned int _count, the number of items.
+	*/
+	void BuildFromSorted(const Type* _items, unsigned int _count);
+
 	/*
 		DESCRIPTION: Removes an item from the tree.
 		PARAMETERS:
@@ -168,7 +380,8 @@ public:
 	bool Find(const Type& _data) const;
 
 	/*
-		DESCRIPTION: Clears all items from the tree and cleans up dynamic memory.
+		DESCRIPTION: Clears all items from the tree and cleans up dynamic memory. If Type is trivially destructible 
+			and the allocator supports it, all nodes are released at once instead of one at a time.
 	*/
 	void Clear();
 
@@ -187,31 +400,89 @@ public:
 	void ToArrayPreorder(Type* _outArray) const;
 	void ToArrayPostorder(Type* _outArray) const;
 	void ToArrayInReverseOrder(Type* _outArray) const;
+
+	/*
+		DESCRIPTION: Provides iterators for walking the items in sorted order. The names follow the standard library, 
+			so the tree can be used in a range-based for loop and with the standard algorithms. Finding the first item 
+			is O(log N) on average.
+		RETURNS: (Iterator) An iterator to the lowest item, or past the highest item.
+	*/
+	Iterator begin() const;
+	Iterator end() const;
+
+	/*
+		DESCRIPTION: Provides iterators for walking the items in reverse sorted order.
+		RETURNS: (ReverseIterator) An iterator to the highest item, or past the lowest item.
+	*/
+	ReverseIterator rbegin() const;
+	ReverseIterator rend() const;
+
+	/*
+		DESCRIPTION: Saves the items in the tree to a snapshot file in sorted order. Type must be trivially copyable.
+		PARAMETERS:
+			const char* _path, the path of the file to write. An existing file is replaced.
+		RETURNS: (bool) true, if all of the items were written.
+	*/
+	bool Save(const char* _path) const;
+
+	/*
+		DESCRIPTION: Replaces the items in the tree with the items in a snapshot file written by Save(). The tree is 
+			built perfectly balanced in O(N), no matter the shape of the tree that was saved. Where supported, the file 
+			is memory mapped, so the items are copied straight from the file into the nodes. Type must be trivially 
+			copyable.
+		PARAMETERS:
+			const char* _path, the path of the file to read.
+		RETURNS: (bool) true, if the items were loaded. If the file cannot be read, holds items of a different size, 
+			or its items are not sorted by the comparison function, the tree is left unchanged.
+	*/
+	bool Load(const char* _path);
 };
 
-template<typename Type>
-BinarySearchTree<Type>::BinarySearchTree(std::function<bool(const Type&, const Type&)> _isLesser, std::function<bool(const Type&, const Type&)> _isGreater) :
+template<typename Type, typename Compare, template<typename> class Allocator>
+BinarySearchTree<Type, Compare, Allocator>::BinarySearchTree(const Compare& _compare) :
 	m_root(nullptr),
-	m_isLesser(_isLesser),
-	m_isGreater(_isGreater)
+	m_size(0),
+	m_compare(_compare)
 {
 }
 
-template<typename Type>
-BinarySearchTree<Type>::BinarySearchTree(const BinarySearchTree<Type>& _bst)
+template<typename Type, typename Compare, template<typename> class Allocator>
+BinarySearchTree<Type, Compare, Allocator>::BinarySearchTree(CompareFunction _isLesser, CompareFunction _isGreater) :
+	m_root(nullptr),
+	m_size(0),
+	m_compare(_isLesser)
+{
+	static_assert(IsCompareFunctionStorable::value, "Compare must be a \"lesser\" function that can be constructed from a std::function.");
+	assert(_isLesser && _isGreater);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+BinarySearchTree<Type, Compare, Allocator>::BinarySearchTree(const Type* _items, unsigned int _count, const Compare& _compare) :
+	m_root(nullptr),
+	m_size(0),
+	m_compare(_compare)
+{
+	Insert(_items, _count);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+BinarySearchTree<Type, Compare, Allocator>::BinarySearchTree(const BinarySearchTree<Type, Compare, Allocator>& _bst) :
+	m_root(nullptr),
+	m_size(0),
+	m_compare(_bst.m_compare)
 {
 	if (_bst.m_root)
 		CopyAll(_bst.m_root);
 }
 
-template<typename Type>
-BinarySearchTree<Type>::~BinarySearchTree()
+template<typename Type, typename Compare, template<typename> class Allocator>
+BinarySearchTree<Type, Compare, Allocator>::~BinarySearchTree()
 {
 	Clear();
 }
 
-template<typename Type>
-BinarySearchTree<Type>& BinarySearchTree<Type>::operator=(const BinarySearchTree<Type>& _bst)
+template<typename Type, typename Compare, template<typename> class Allocator>
+BinarySearchTree<Type, Compare, Allocator>& BinarySearchTree<Type, Compare, Allocator>::operator=(const BinarySearchTree<Type, Compare, Allocator>& _bst)
 {
 	// We don't need to do anything if we are assigning to ourself.
 	if (this == &_bst)
@@ -219,340 +490,574 @@ BinarySearchTree<Type>& BinarySearchTree<Type>::operator=(const BinarySearchTree
 
 	Clear();
 
+	m_compare = _bst.m_compare;
+
 	if (_bst.m_root)
 		CopyAll(_bst.m_root);
 
 	return *this;
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::Insert(const Type& _data)
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::CreateNode(const Type& _data, Node* _parentNode)
 {
-	if (!m_root)
-		m_root = new Node{ _data, nullptr, nullptr };
-	else
-		Insert(_data, m_root);
+	return new (m_allocator.Allocate()) Node{ _data, nullptr, nullptr, _parentNode };
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::Insert(const Type& _data, Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::DestroyNode(Node* _node)
 {
-	if (m_isLesser(_data, _node->data))
-	{
-		if (!_node->left)
-			_node->left = new Node{ _data, nullptr, nullptr }; // If no left node, add one.
-		else
-			Insert(_data, _node->left); // Otherwise, go left.
-	}
-	else if (!_node->right)
-		_node->right = new Node{ _data, nullptr, nullptr }; // If no right node, add one.
-	else
-		Insert(_data, _node->right); // Otherwise, go right.
+	_node->~Node();
+	m_allocator.Deallocate(_node);
 }
 
-template<typename Type>
-bool BinarySearchTree<Type>::Remove(const Type& _data)
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::IsLesser(const Type& _lhs, const Type& _rhs) const
 {
-	return Remove(_data, m_root);
+	return IsLesser(_lhs, _rhs, IsLesserCompare());
 }
 
-template<typename Type>
-bool BinarySearchTree<Type>::Remove(const Type& _data, Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::IsLesser(const Type& _lhs, const Type& _rhs, std::true_type) const
 {
-	if (!_node)
-		return false;
+	return m_compare(_lhs, _rhs);
+}
 
-	if (m_isLesser(_data, _node->data))
-	{
-		Node* leftNode = _node->left;
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::IsLesser(const Type& _lhs, const Type& _rhs, std::false_type) const
+{
+	return m_compare(_lhs, _rhs) < 0;
+}
 
-		if (leftNode && leftNode->data == _data)
-		{
-			// Found the node. Now Remove it.
-
-			if (!leftNode->left)
-			{
-				if (!leftNode->right)
-				{
-					// The node has no children.
-
-					delete leftNode;
-					_node->left = nullptr;
-				}
-				else
-				{
-					// Node has child on the right.
-
-					_node->left = leftNode->right;
-					delete leftNode;
-				}
-			}
-			else if (!leftNode->right)
-			{
-				// Node has child on the left.
-
-				_node->left = leftNode->left;
-				delete leftNode;
-			}
-			else
-			{
-				// Node has two children.
-
-				Node* minNode = RemoveMin(leftNode->right); // Get the minimum value node from the right child...
-				leftNode->data = minNode->data; // ... and assign its value to this node.
-
-				// If the right child is the minimum value node, then its right child needs to take its place.
-				if (leftNode->right == minNode)
-					leftNode->right = minNode->right;
-
-				delete minNode;
-			}
+template<typename Type, typename Compare, template<typename> class Allocator>
+int BinarySearchTree<Type, Compare, Allocator>::Order(const Type& _lhs, const Type& _rhs) const
+{
+	return Order(_lhs, _rhs, IsLesserCompare());
+}
 
-			return true;
-		}
+template<typename Type, typename Compare, template<typename> class Allocator>
+int BinarySearchTree<Type, Compare, Allocator>::Order(const Type& _lhs, const Type& _rhs, std::true_type) const
+{
+	if (m_compare(_lhs, _rhs))
+		return -1;
 
-		// The node to Remove may be further left.
-		return Remove(_data, leftNode);
-	}
-	else if (m_isGreater(_data, _node->data))
+	return (m_compare(_rhs, _lhs)) ? 1 : 0;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+int BinarySearchTree<Type, Compare, Allocator>::Order(const Type& _lhs, const Type& _rhs, std::false_type) const
+{
+	const auto order = m_compare(_lhs, _rhs);
+
+	return (order < 0) ? -1 : ((order > 0) ? 1 : 0);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::Insert(const Type& _data)
+{
+	// Follow the links down to the empty one where the item belongs. Equal items go to the right.
+	Node* parentNode = nullptr;
+	Node** link = &m_root;
+
+	while (*link)
 	{
-		Node* rightNode = _node->right;
+		parentNode = *link;
+		link = (IsLesser(_data, parentNode->data)) ? &parentNode->left : &parentNode->right;
+	}
 
-		if (rightNode && rightNode->data == _data)
-		{
-			// Found the node. Now Remove it.
-
-			if (!rightNode->left)
-			{
-				if (!rightNode->right)
-				{
-					// The node has no children.
-
-					delete rightNode;
-					_node->right = nullptr;
-				}
-				else
-				{
-					// Node has child on the right.
-
-					_node->right = rightNode->right;
-					delete rightNode;
-				}
-			}
-			else if (!rightNode->right)
-			{
-				// Node has child on the left.
-
-				_node->right = rightNode->left;
-				delete rightNode;
-			}
-			else
-			{
-				// Node has two children.
-
-				Node* minNode = RemoveMin(rightNode->right); // Get the minimum value node from the right child...
-				rightNode->data = minNode->data; // ... and assign its value to this node.
-
-				// If the right child is the minimum value node, then its right child needs to take its place.
-				if (rightNode->right == minNode)
-					rightNode->right = minNode->right;
-
-				delete minNode;
-			}
+	*link = CreateNode(_data, parentNode);
+	++m_size;
+}
 
-			return true;
-		}
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::Remove(const Type& _data)
+{
+	Node* parentNode = nullptr;
+	Node* node = m_root;
+
+	while (node)
+	{
+		const int order = Order(_data, node->data);
+
+		if (order == 0)
+			break;
 
-		// The node to Remove may be further right.
-		return Remove(_data, rightNode);
+		// The node to Remove may be further left or right.
+		parentNode = node;
+		node = (order < 0) ? node->left : node->right;
 	}
-	else if (_node->right)
+
+	if (!node)
+		return false;
+
+	// Found the node. Now Remove it.
+
+	Node* newNode;
+
+	if (!node->left)
+		newNode = node->right; // Node has no children or a child on the right.
+	else if (!node->right)
+		newNode = node->left; // Node has child on the left.
+	else
 	{
-		// The node to Remove is the root. It has a child on the right. It may or may not have a child on the left.
+		// Node has two children. The minimum value node from the right child takes its place.
 
-		Node* minNode = RemoveMin(_node->right); // Get the minimum value node from the right child...
-		minNode->left = _node->left; // ... and point minNode's left to the left child.
+		newNode = RemoveMin(node->right, node);
+		newNode->left = node->left;
+		newNode->right = node->right;
 
-		// If the right child is not the minimum value node, then point minNode's right to the right child.
-		if (_node->right != minNode)
-			minNode->right = _node->right;
+		newNode->left->parent = newNode;
+		if (newNode->right)
+			newNode->right->parent = newNode;
+	}
+
+	Reparent(node, parentNode, newNode);
+	DestroyNode(node);
+
+	--m_size;
+	return true;
+}
 
-		delete _node;
-		m_root = minNode;
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::Find(const Type& _data) const
+{
+	for (const Node* node = m_root; node; )
+	{
+		const int order = Order(_data, node->data);
 
-		return true;
+		if (order < 0)
+			node = node->left;
+		else if (order > 0)
+			node = node->right;
+		else
+			return true;
 	}
 
-	// The node to Remove is the root. It may or may not have a child on the left.
+	return false;
+}
 
-	m_root = _node->left; // This may or may not be nullptr.
-	delete _node;
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::Clear()
+{
+	// Nodes that have nothing to destroy don't need to be visited if the allocator can release them all at once.
+	if (!std::is_trivially_destructible<Type>::value || !m_allocator.ReleaseAll())
+		Clear(m_root);
 
-	return true;
+	m_root = nullptr;
+	m_size = 0;
 }
 
-template<typename Type>
-bool BinarySearchTree<Type>::Find(const Type& _data) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::Clear(Node* _node)
 {
-	return Find(_data, m_root);
+	while (_node)
+	{
+		if (_node->left)
+		{
+			// Rotate the left child up to take the node's place.
+			Node* left = _node->left;
+			_node->left = left->right;
+			left->right = _node;
+			_node = left;
+		}
+		else
+		{
+			Node* right = _node->right;
+			DestroyNode(_node);
+			_node = right;
+		}
+	}
 }
 
-template<typename Type>
-bool BinarySearchTree<Type>::Find(const Type& _data, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+unsigned int BinarySearchTree<Type, Compare, Allocator>::Size() const
 {
-	if (!_node)
-		return false;
+	return m_size;
+}
 
-	if (m_isLesser(_data, _node->data))
-		return Find(_data, _node->left);
-	else if (m_isGreater(_data, _node->data))
-		return Find(_data, _node->right);
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::ToArrayInorder(Type* _outArray) const
+{
+	VisitInorder([&_outArray](const Type& _data) { *_outArray++ = _data; });
+}
 
-	return true;
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::ToArrayPreorder(Type* _outArray) const
+{
+	VisitPreorder([&_outArray](const Type& _data) { *_outArray++ = _data; });
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::Clear()
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::ToArrayPostorder(Type* _outArray) const
 {
-	Clear(m_root);
-	m_root = nullptr;
+	VisitPostorder([&_outArray](const Type& _data) { *_outArray++ = _data; });
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::Clear(Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::ToArrayInReverseOrder(Type* _outArray) const
 {
-	if (!_node)
-		return;
+	VisitInReverseOrder([&_outArray](const Type& _data) { *_outArray++ = _data; });
+}
 
-	Clear(_node->left);
-	Clear(_node->right);
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::Iterator BinarySearchTree<Type, Compare, Allocator>::begin() const
+{
+	return Iterator(Minimum(m_root), this);
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::Iterator BinarySearchTree<Type, Compare, Allocator>::end() const
+{
+	return Iterator(nullptr, this);
+}
 
-	delete _node;
-	_node = nullptr;
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::ReverseIterator BinarySearchTree<Type, Compare, Allocator>::rbegin() const
+{
+	return ReverseIterator(end());
 }
 
-template<typename Type>
-unsigned int BinarySearchTree<Type>::Size() const
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::ReverseIterator BinarySearchTree<Type, Compare, Allocator>::rend() const
 {
-	return Size(m_root);
+	return ReverseIterator(begin());
 }
 
-template<typename Type>
-unsigned int BinarySearchTree<Type>::Size(Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::Minimum(const Node* _node)
 {
-	if (!_node)
-		return 0;
+	if (_node)
+	{
+		while (_node->left)
+			_node = _node->left;
+	}
 
-	return Size(_node->left) + Size(_node->right) + 1;
+	return _node;
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayInorder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::Maximum(const Node* _node)
 {
-	int arrayIndex = 0;
-	ToArrayInorder(_outArray, arrayIndex, m_root);
+	if (_node)
+	{
+		while (_node->right)
+			_node = _node->right;
+	}
+
+	return _node;
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayPreorder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::Next(const Node* _node)
 {
-	int arrayIndex = 0;
-	ToArrayPreorder(_outArray, arrayIndex, m_root);
+	if (_node->right)
+		return Minimum(_node->right);
+
+	// Go up until coming from a left child. That parent is the next node.
+	while (_node->parent && _node->parent->right == _node)
+		_node = _node->parent;
+
+	return _node->parent;
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayPostorder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+const typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::Previous(const Node* _node)
 {
-	int arrayIndex = 0;
-	ToArrayPostorder(_outArray, arrayIndex, m_root);
+	if (_node->left)
+		return Maximum(_node->left);
+
+	// Go up until coming from a right child. That parent is the previous node.
+	while (_node->parent && _node->parent->left == _node)
+		_node = _node->parent;
+
+	return _node->parent;
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayInReverseOrder(Type* _outArray) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void BinarySearchTree<Type, Compare, Allocator>::VisitInorder(Visitor _visit) const
 {
-	int arrayIndex = 0;
-	ToArrayInReverseOrder(_outArray, arrayIndex, m_root);
+	NodeStack stack;
+	Node* node = m_root;
+
+	while (node || stack.Size() > 0)
+	{
+		// Go as far left as possible, remembering the nodes to come back to.
+		for (; node; node = node->left)
+			stack.Append(node);
+
+		node = stack[stack.Size() - 1];
+		stack.RemoveLast();
+
+		_visit(static_cast<const Type&>(node->data));
+		node = node->right;
+	}
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayInorder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void BinarySearchTree<Type, Compare, Allocator>::VisitPreorder(Visitor _visit) const
 {
-	if (!_node)
+	if (!m_root)
 		return;
 
-	ToArrayInorder(_outArray, _outArrayIndex, _node->left);
-	_outArray[_outArrayIndex++] = _node->data;
-	ToArrayInorder(_outArray, _outArrayIndex, _node->right);
+	NodeStack stack;
+	stack.Append(m_root);
+
+	while (stack.Size() > 0)
+	{
+		Node* node = stack[stack.Size() - 1];
+		stack.RemoveLast();
+
+		_visit(static_cast<const Type&>(node->data));
+
+		// The right child is pushed first, so that the left child is visited first.
+		if (node->right)
+			stack.Append(node->right);
+
+		if (node->left)
+			stack.Append(node->left);
+	}
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayPreorder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void BinarySearchTree<Type, Compare, Allocator>::VisitPostorder(Visitor _visit) const
 {
-	if (!_node)
-		return;
+	NodeStack stack;
+	Node* node = m_root;
+	const Node* visitedNode = nullptr; // The last node visited, to tell if a right child has been visited yet.
+
+	while (node || stack.Size() > 0)
+	{
+		// Go as far left as possible, remembering the nodes to come back to.
+		for (; node; node = node->left)
+			stack.Append(node);
+
+		Node* topNode = stack[stack.Size() - 1];
 
-	_outArray[_outArrayIndex++] = _node->data;
-	ToArrayPreorder(_outArray, _outArrayIndex, _node->left);
-	ToArrayPreorder(_outArray, _outArrayIndex, _node->right);
+		if (topNode->right && topNode->right != visitedNode)
+			node = topNode->right; // Visit the right child before the node.
+		else
+		{
+			_visit(static_cast<const Type&>(topNode->data));
+			visitedNode = topNode;
+			stack.RemoveLast();
+		}
+	}
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayPostorder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+template<typename Visitor>
+void BinarySearchTree<Type, Compare, Allocator>::VisitInReverseOrder(Visitor _visit) const
 {
-	if (!_node)
-		return;
+	NodeStack stack;
+	Node* node = m_root;
+
+	while (node || stack.Size() > 0)
+	{
+		// Go as far right as possible, remembering the nodes to come back to.
+		for (; node; node = node->right)
+			stack.Append(node);
+
+		node = stack[stack.Size() - 1];
+		stack.RemoveLast();
 
-	ToArrayPostorder(_outArray, _outArrayIndex, _node->left);
-	ToArrayPostorder(_outArray, _outArrayIndex, _node->right);
-	_outArray[_outArrayIndex++] = _node->data;
+		_visit(static_cast<const Type&>(node->data));
+		node = node->left;
+	}
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::ToArrayInReverseOrder(Type* _outArray, int& _outArrayIndex, Node* _node) const
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::Insert(const Type* _items, unsigned int _count)
 {
-	if (!_node)
+	const unsigned int size = m_size;
+
+	// A small batch costs less to insert one item at a time than to rebuild the whole tree around it.
+	if (_count == 0 || _count < size / REBUILD_FRACTION)
+	{
+		for (unsigned int i = 0; i < _count; ++i)
+			Insert(_items[i]);
+
 		return;
+	}
+
+	// Sort a copy of the items, unless they are already sorted.
+	DynamicArray<Type> sortedItems;
 
-	ToArrayInReverseOrder(_outArray, _outArrayIndex, _node->right);
-	_outArray[_outArrayIndex++] = _node->data;
-	ToArrayInReverseOrder(_outArray, _outArrayIndex, _node->left);
+	if (!IsSorted(_items, _count))
+	{
+		sortedItems.AppendRange(_items, _count);
+		std::sort(&sortedItems[0], &sortedItems[0] + _count, [this](const Type& _lhs, const Type& _rhs) { return IsLesser(_lhs, _rhs); });
+		_items = &sortedItems[0];
+	}
+
+	if (!m_root)
+	{
+		m_root = BuildBalanced(_items, _count);
+		m_size = _count;
+		return;
+	}
+
+	// Merge the items with the items in the tree, then rebuild the tree from the merged items.
+	DynamicArray<Type> merged;
+	merged.Reserve(size + _count);
+
+	// Items equal to an item in the tree go after it, the same place Insert() would put them.
+	const Type* itemsEnd = _items + _count;
+
+	VisitInorder([&](const Type& _data)
+	{
+		for (; _items != itemsEnd && IsLesser(*_items, _data); ++_items)
+			merged.Append(*_items);
+
+		merged.Append(_data);
+	});
+
+	merged.AppendRange(_items, static_cast<unsigned int>(itemsEnd - _items));
+
+	Clear();
+	m_root = BuildBalanced(&merged[0], merged.Size());
+	m_size = merged.Size();
 }
 
-template<typename Type>
-typename BinarySearchTree<Type>::Node* BinarySearchTree<Type>::RemoveMin(Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::BuildFromSorted(const Type* _items, unsigned int _count)
 {
-	if (!_node)
-		return _node;
+	assert(IsSorted(_items, _count));
 
-	Node* nodeLeft = _node->left;
+	Clear();
+	m_root = BuildBalanced(_items, _count);
+	m_size = _count;
+}
 
-	if (nodeLeft)
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::IsSorted(const Type* _items, unsigned int _count) const
+{
+	for (unsigned int i = 1; i < _count; ++i)
 	{
-		if (nodeLeft->left)
-			return RemoveMin(nodeLeft);
-		else if (nodeLeft->right)
-		{
-			// The right child is the minimum value node. Remove it from the tree and return it.
-			_node->left = nodeLeft->right;
-			return nodeLeft;
-		}
+		if (IsLesser(_items[i], _items[i - 1]))
+			return false;
+	}
+
+	return true;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::Save(const char* _path) const
+{
+	static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable types can be saved.");
+
+	SnapshotWriter writer(_path, sizeof(Type), m_size);
+	VisitInorder([&writer](const Type& _data) { writer.Write(&_data, sizeof(Type)); });
 
-		// NodeLeft is the minimum value node. Remove it from the tree and return it.
-		_node->left = nullptr;
-		return nodeLeft;
+	return writer.Close();
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+bool BinarySearchTree<Type, Compare, Allocator>::Load(const char* _path)
+{
+	static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable types can be loaded.");
+	static_assert(alignof(Type) <= alignof(std::max_align_t), "Over-aligned types cannot be loaded.");
+
+	SnapshotReader reader(_path, sizeof(Type));
+	if (!reader.IsOpen())
+		return false;
+
+	const Type* items = static_cast<const Type*>(reader.Items());
+	const unsigned int count = reader.Count();
+
+	// Building the tree trusts the order of the items, so check it first.
+	if (!IsSorted(items, count))
+		return false;
+
+	Clear();
+	m_root = BuildBalanced(items, count);
+	m_size = count;
+
+	return true;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::BuildBalanced(const Type* _items, unsigned int _count)
+{
+	if (_count == 0)
+		return nullptr;
+
+	const unsigned int middle = _count / 2;
+
+	Node* node = CreateNode(_items[middle], nullptr);
+	node->left = BuildBalanced(_items, middle);
+	node->right = BuildBalanced(_items + middle + 1, _count - middle - 1);
+
+	if (node->left)
+		node->left->parent = node;
+
+	if (node->right)
+		node->right->parent = node;
+
+	return node;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+typename BinarySearchTree<Type, Compare, Allocator>::Node* BinarySearchTree<Type, Compare, Allocator>::RemoveMin(Node* _node, Node* _parentNode)
+{
+	assert(_node);
+
+	// Iterate to the leftmost node.
+	while (_node->left)
+	{
+		_parentNode = _node;
+		_node = _node->left;
 	}
 
-	// This node is the minimum value node. Return it without removing it.
+	// The leftmost node is the minimum value node. Its right child takes its place.
+	Reparent(_node, _parentNode, _node->right);
+
 	return _node;
 }
 
-template<typename Type>
-void BinarySearchTree<Type>::CopyAll(Node* _node)
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::Reparent(Node* _node, Node* _parentNode, Node* _newNode)
 {
-	if (!_node)
-		return;
+	if (!_parentNode)
+		m_root = _newNode;
+	else if (_parentNode->left == _node)
+		_parentNode->left = _newNode;
+	else
+		_parentNode->right = _newNode;
+
+	if (_newNode)
+		_newNode->parent = _parentNode;
+}
+
+template<typename Type, typename Compare, template<typename> class Allocator>
+void BinarySearchTree<Type, Compare, Allocator>::CopyAll(const Node* _root)
+{
+	// A node to copy, the link in this tree that its copy goes in, and the node that link belongs to.
+	struct Copy
+	{
+		const Node* node;
+		Node** link;
+		Node* parent;
+	};
+
+	DynamicArray<Copy, 64> stack;
+	stack.Append(Copy{ _root, &m_root, nullptr });
+
+	while (stack.Size() > 0)
+	{
+		const Copy copy = stack[stack.Size() - 1];
+		stack.RemoveLast();
+
+		if (!copy.node)
+			continue;
 
-	CopyAll(_node->left);
-	CopyAll(_node->right);
-	Insert(_node->data);
+		Node* node = CreateNode(copy.node->data, copy.parent);
+		*copy.link = node;
+		++m_size;
+
+		stack.Append(Copy{ copy.node->right, &node->right, node });
+		stack.Append(Copy{ copy.node->left, &node->left, node });
+	}
 }
@@ -2,7 +2,7 @@
 	FILE: DoublyLinkedList.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 23, 2021
-	MODIFIED: January 29, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: A templated Doubly-Linked List data structure. The benefits of this Linked List are:
 		- AddHead(): On average O(1), worst case O(1).
 		- AddTail(): On average O(1), worst case O(1).
@@ -17,10 +17,12 @@
 
 #pragma once
 
+#include "NodeAllocator.h" // Used for HeapAllocator, the default node allocator.
+
 /*
 	DESCRIPTION: A Linked List of nodes that supports forward and backward traversal.
 */
-template<typename Type> 
+template<typename Type, template<typename> class Allocator = HeapAllocator>
 class DoublyLinkedList
 {
 public:
@@ -29,7 +31,7 @@ public:
 	*/
 	class Node
 	{
-		friend typename DoublyLinkedList<Type>;
+		friend typename DoublyLinkedList<Type, Allocator>;
 
 	private:
 		// DATA MEMBERS
@@ -73,6 +75,26 @@ private:
 	Node* m_head; // The head of the list.
 	Node* m_tail; // The tail of the list.
 	unsigned int m_size; // The number of items in the list.
+	Allocator<Node> m_allocator; // Provides the memory for each node.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates a node with the allocator and constructs it.
+		PARAMETERS:
+			const Type& _data, the item the node houses.
+			Node* _prev, the node before the new node.
+			Node* _next, the node after the new node.
+		RETURNS: (Node*) The new node.
+	*/
+	inline Node* CreateNode(const Type& _data, Node* _prev, Node* _next);
+
+	/*
+		DESCRIPTION: Destroys a node and returns its memory to the allocator.
+		PARAMETERS:
+			Node* _node, the node to destroy.
+	*/
+	inline void DestroyNode(Node* _node);
 
 public:
 	// FUNCTIONS
@@ -85,9 +107,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided list.
 		PARAMETERS:
-			const DoublyLinkedList<Type>& _list, the list to copy.
+			const DoublyLinkedList<Type, Allocator>& _list, the list to copy.
 	*/
-	DoublyLinkedList(const DoublyLinkedList<Type>& _list);
+	DoublyLinkedList(const DoublyLinkedList<Type, Allocator>& _list);
 
 	/*
 		DESCRIPTION: Deallocates the list.
@@ -97,9 +119,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided list.
 		PARAMETERS:
-			const DoublyLinkedList<Type>& _list, the list to copy.
+			const DoublyLinkedList<Type, Allocator>& _list, the list to copy.
 	*/
-	DoublyLinkedList<Type>& operator=(const DoublyLinkedList<Type>& _list);
+	DoublyLinkedList<Type, Allocator>& operator=(const DoublyLinkedList<Type, Allocator>& _list);
 
 	/*
 		DESCRIPTION: Adds an item to the head of the list.
@@ -175,15 +197,18 @@ public:
 	inline Node* PeekTail();
 };
 
-template<typename T>
-DoublyLinkedList<T>::DoublyLinkedList()
+template<typename Type, template<typename> class Allocator>
+DoublyLinkedList<Type, Allocator>::DoublyLinkedList()
 {
 	m_head = m_tail = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-DoublyLinkedList<Type>::DoublyLinkedList(const DoublyLinkedList<Type>& _list)
+template<typename Type, template<typename> class Allocator>
+DoublyLinkedList<Type, Allocator>::DoublyLinkedList(const DoublyLinkedList<Type, Allocator>& _list) :
+	m_head(nullptr),
+	m_tail(nullptr),
+	m_size(0)
 {
 	Node* iter = _list.m_head;
 
@@ -192,18 +217,18 @@ DoublyLinkedList<Type>::DoublyLinkedList(const DoublyLinkedList<Type>& _list)
 		do
 		{
 			AddTail(iter->m_data);
-		} while (iter = iter->m_next);
+		} while ((iter = iter->m_next));
 	}
 }
 
-template<typename T>
-DoublyLinkedList<T>::~DoublyLinkedList()
+template<typename Type, template<typename> class Allocator>
+DoublyLinkedList<Type, Allocator>::~DoublyLinkedList()
 {
 	Clear();
 }
 
-template<typename Type>
-DoublyLinkedList<Type>& DoublyLinkedList<Type>::operator=(const DoublyLinkedList<Type>& _list)
+template<typename Type, template<typename> class Allocator>
+DoublyLinkedList<Type, Allocator>& DoublyLinkedList<Type, Allocator>::operator=(const DoublyLinkedList<Type, Allocator>& _list)
 {
 	// We don't need to do anything if we are assigning to ourself.
 	if (this == &_list)
@@ -219,42 +244,42 @@ DoublyLinkedList<Type>& DoublyLinkedList<Type>::operator=(const DoublyLinkedList
 		do
 		{
 			AddTail(iter->m_data);
-		} while (iter = iter->m_next);
+		} while ((iter = iter->m_next));
 	}
 
 	return *this;
 }
 
-template<typename Type>
-void DoublyLinkedList<Type>::AddHead(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void DoublyLinkedList<Type, Allocator>::AddHead(const Type& _data)
 {
 	if (m_head)
 	{
-		m_head->m_prev = new Node(_data, nullptr, m_head);
+		m_head->m_prev = CreateNode(_data, nullptr, m_head);
 		m_head = m_head->m_prev;
 	}
 	else
-		m_head = m_tail = new Node(_data, nullptr, nullptr);
+		m_head = m_tail = CreateNode(_data, nullptr, nullptr);
 
 	++m_size;
 }
 
-template<typename Type>
-void DoublyLinkedList<Type>::AddTail(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void DoublyLinkedList<Type, Allocator>::AddTail(const Type& _data)
 {
 	if (m_tail)
 	{
-		m_tail->m_next = new Node(_data, m_tail, nullptr);
+		m_tail->m_next = CreateNode(_data, m_tail, nullptr);
 		m_tail = m_tail->m_next;
 	}
 	else
-		m_head = m_tail = new Node(_data, nullptr, nullptr);
+		m_head = m_tail = CreateNode(_data, nullptr, nullptr);
 
 	++m_size;
 }
 
-template<typename Type>
-void DoublyLinkedList<Type>::Insert(Node* _node, const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void DoublyLinkedList<Type, Allocator>::Insert(Node* _node, const Type& _data)
 {
 	if (!_node)
 		AddHead(_data);
@@ -264,18 +289,18 @@ void DoublyLinkedList<Type>::Insert(Node* _node, const Type& _data)
 
 		if (prevNode)
 		{
-			prevNode->m_next = new Node(_data, prevNode, _node);
+			prevNode->m_next = CreateNode(_data, prevNode, _node);
 			_node->m_prev = prevNode->m_next;
 		}
 		else
-			m_head = _node->m_prev = new Node(_data, nullptr, _node);
+			m_head = _node->m_prev = CreateNode(_data, nullptr, _node);
 
 		++m_size;
 	}
 }
 
-template<typename Type>
-bool DoublyLinkedList<Type>::Remove(Node* _node)
+template<typename Type, template<typename> class Allocator>
+bool DoublyLinkedList<Type, Allocator>::Remove(Node* _node)
 {
 	if (!_node)
 		return false;
@@ -296,15 +321,15 @@ bool DoublyLinkedList<Type>::Remove(Node* _node)
 		else if (_node == m_tail)
 			m_tail = prevNode;
 
-		delete _node;
+		DestroyNode(_node);
 		--m_size;
 	}
 
 	return true;
 }
 
-template<typename Type>
-bool DoublyLinkedList<Type>::RemoveHead()
+template<typename Type, template<typename> class Allocator>
+bool DoublyLinkedList<Type, Allocator>::RemoveHead()
 {
 	if (!m_head)
 		return false;
@@ -317,14 +342,14 @@ bool DoublyLinkedList<Type>::RemoveHead()
 	else
 		m_tail = nullptr;
 
-	delete delNode;
+	DestroyNode(delNode);
 	--m_size;
 
 	return true;
 }
 
-template<typename Type>
-bool DoublyLinkedList<Type>::RemoveTail()
+template<typename Type, template<typename> class Allocator>
+bool DoublyLinkedList<Type, Allocator>::RemoveTail()
 {
 	if (!m_tail)
 		return false;
@@ -337,14 +362,14 @@ bool DoublyLinkedList<Type>::RemoveTail()
 	else
 		m_head = nullptr;
 
-	delete delNode;
+	DestroyNode(delNode);
 	--m_size;
 
 	return true;
 }
 
-template<typename Type>
-bool DoublyLinkedList<Type>::Find(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+bool DoublyLinkedList<Type, Allocator>::Find(const Type& _data)
 {
 	for (Node* iter = m_head; iter; iter = iter->m_next)
 		if (iter->m_data == _data)
@@ -353,8 +378,8 @@ bool DoublyLinkedList<Type>::Find(const Type& _data)
 	return false;
 }
 
-template<typename Type>
-void DoublyLinkedList<Type>::Clear()
+template<typename Type, template<typename> class Allocator>
+void DoublyLinkedList<Type, Allocator>::Clear()
 {
 	Node* iter;
 
@@ -362,27 +387,40 @@ void DoublyLinkedList<Type>::Clear()
 	{
 		iter = m_head;
 		m_head = m_head->m_next;
-		delete iter;
+		DestroyNode(iter);
 	}
 
 	m_head = m_tail = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-inline unsigned int DoublyLinkedList<Type>::Size() const
+template<typename Type, template<typename> class Allocator>
+inline unsigned int DoublyLinkedList<Type, Allocator>::Size() const
 {
 	return m_size;
 }
 
-template<typename Type>
-typename DoublyLinkedList<Type>::Node* DoublyLinkedList<Type>::PeekHead()
+template<typename Type, template<typename> class Allocator>
+typename DoublyLinkedList<Type, Allocator>::Node* DoublyLinkedList<Type, Allocator>::PeekHead()
 {
 	return m_head;
 }
 
-template<typename Type>
-typename DoublyLinkedList<Type>::Node* DoublyLinkedList<Type>::PeekTail()
+template<typename Type, template<typename> class Allocator>
+typename DoublyLinkedList<Type, Allocator>::Node* DoublyLinkedList<Type, Allocator>::PeekTail()
 {
 	return m_tail;
 }
+
+template<typename Type, template<typename> class Allocator>
+typename DoublyLinkedList<Type, Allocator>::Node* DoublyLinkedList<Type, Allocator>::CreateNode(const Type& _data, Node* _prev, Node* _next)
+{
+	return new (m_allocator.Allocate()) Node(_data, _prev, _next);
+}
+
+template<typename Type, template<typename> class Allocator>
+void DoublyLinkedList<Type, Allocator>::DestroyNode(Node* _node)
+{
+	_node->~Node();
+	m_allocator.Deallocate(_node);
+}
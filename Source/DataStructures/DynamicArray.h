@@ -2,31 +2,165 @@
 	FILE: DynamicArray.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 16, 2021
-	MODIFIED: January 27, 2021
-	DESCRIPTION: A dynamically allocating data structure with contiguous storage. The benefits are:
+	MODIFIED: October 16, 2026
+	DESCRIPTION: A dynamically allocating data structure with contiguous storage. Only the items in the array are 
+		constructed, so the spare capacity costs nothing until it is used and items do not need a default 
+		constructor. The benefits are:
 		- Append(): On average O(1), worst case O(N).
 		- Insert(): On average O(N/2), worst case O(N).
 		- Remove(): On average O(N/2), worst case O(N).
-		- Find(): On average O(N/2), worst case O(N).
+		- SwapRemove(): O(1), but the order of the items is not kept.
+		- AppendRange(), InsertRange(), RemoveRange(): Shift the items once for the whole range, so they cost the 
+			same as a single Append(), Insert(), or Remove() plus the size of the range.
+		- Find(): On average O(N/2), worst case O(N). Arrays of arithmetic types are searched with SIMD 
+			instructions when the CPU supports them.
+	The first InlineCapacity items are stored inside the array itself, so small arrays never allocate. The 
+	GrowthPolicy picks the capacity to grow to when the array is full, see GrowthPolicy.h. The Allocator provides 
+	the memory beyond the inline capacity, see ArrayAllocator.h.
 */
 
 #pragma once
 
 #include <assert.h>
+#include <cstring> // Used for std::memcpy and std::memmove.
+#include <new> // Used for placement new.
+#include <type_traits> // Used to find trivially copyable types, which can be copied as raw memory.
+#include <utility> // Used for std::move and std::forward.
+
+#include "../Algorithms/Searching.h"
+#include "ArrayAllocator.h"
+#include "GrowthPolicy.h"
 
 /*
-	DESCRIPTION: A dynamically expanding array of contiguous storage.
+	DESCRIPTION: Uninitialized storage for a fixed number of items, kept inside the object that owns it.
+*/
+template<typename Type, unsigned int Capacity>
+struct InlineBuffer
+{
+	alignas(Type) unsigned char items[sizeof(Type) * Capacity];
+
+	inline Type* Data() { return reinterpret_cast<Type*>(items); }
+};
+
+/*
+	DESCRIPTION: Storage for no items, used when an array has no inline capacity.
 */
 template<typename Type>
+struct InlineBuffer<Type, 0>
+{
+	inline Type* Data() { return nullptr; }
+};
+
+/*
+	DESCRIPTION: A dynamically expanding array of contiguous storage.
+*/
+template<typename Type, unsigned int InlineCapacity = 0, typename GrowthPolicy = DoublingGrowth, template<typename> class Allocator = HeapArrayAllocator>
 class DynamicArray
 {
 private:
 	// DATA MEMBERS
 
-	Type* m_data; // A pointer to the array
+	// The inline buffer and the allocator are declared first, so they are constructed before m_data is set from them.
+	InlineBuffer<Type, InlineCapacity> m_inlineBuffer; // Storage used while the capacity is InlineCapacity
+	Allocator<Type> m_allocator; // Allocates the storage used when the capacity is more than InlineCapacity
+	Type* m_data; // A pointer to the array. Only the first m_size items are constructed.
 	unsigned int m_size; // Number of items in the container
 	unsigned int m_capacity; // Number of spaces for items in the container
 
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates uninitialized memory for an array of items. The inline buffer is used when it is big 
+			enough, so it must not be holding items.
+		PARAMETERS:
+			unsigned int _capacity, the number of items the memory can hold.
+		RETURNS: Type* - The memory, or nullptr when _capacity is zero.
+	*/
+	inline Type* AllocateItems(unsigned int _capacity);
+
+	/*
+		DESCRIPTION: Deallocates memory returned by AllocateItems(). The items must already be destroyed.
+		PARAMETERS:
+			Type* _items, the memory to deallocate.
+			unsigned int _capacity, the capacity passed to AllocateItems().
+	*/
+	inline void DeallocateItems(Type* _items, unsigned int _capacity);
+
+	/*
+		DESCRIPTION: Takes the items of another array, which is left empty. This array must be empty and using its 
+			inline buffer.
+		PARAMETERS:
+			DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array, the array to take the items of.
+	*/
+	void TakeItems(DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array);
+
+	/*
+		DESCRIPTION: Copy constructs items into uninitialized memory. Trivially copyable items are copied as raw memory.
+		PARAMETERS:
+			Type* _destination, the uninitialized memory to copy to.
+			const Type* _source, the array to copy from. Must not overlap _destination.
+			unsigned int _count, the number of items to copy.
+	*/
+	static void CopyItems(Type* _destination, const Type* _source, unsigned int _count);
+	static void CopyItems(Type* _destination, const Type* _source, unsigned int _count, std::true_type);
+	static void CopyItems(Type* _destination, const Type* _source, unsigned int _count, std::false_type);
+
+	/*
+		DESCRIPTION: Move constructs items into uninitialized memory and destroys the items they were moved from. 
+			Trivially copyable items are copied as raw memory.
+		PARAMETERS:
+			Type* _destination, the uninitialized memory to move to.
+			Type* _source, the array to move from. Must not overlap _destination.
+			unsigned int _count, the number of items to move.
+	*/
+	static void MoveItems(Type* _destination, Type* _source, unsigned int _count);
+	static void MoveItems(Type* _destination, Type* _source, unsigned int _count, std::true_type);
+	static void MoveItems(Type* _destination, Type* _source, unsigned int _count, std::false_type);
+
+	/*
+		DESCRIPTION: Destroys items, leaving their memory uninitialized.
+		PARAMETERS:
+			Type* _items, the items to destroy.
+			unsigned int _count, the number of items to destroy.
+	*/
+	static void DestroyItems(Type* _items, unsigned int _count);
+	static void DestroyItems(Type* _items, unsigned int _count, std::true_type);
+	static void DestroyItems(Type* _items, unsigned int _count, std::false_type);
+
+	/*
+		DESCRIPTION: Returns the capacity to grow to, as chosen by the growth policy.
+		PARAMETERS:
+			unsigned int _size, the number of items the array needs space for.
+		RETURNS: unsigned int - The next capacity.
+	*/
+	inline unsigned int NextCapacity(unsigned int _size) const;
+
+	/*
+		DESCRIPTION: Grows the capacity of the array if there is no space for another item.
+	*/
+	inline void GrowIfFull();
+
+	/*
+		DESCRIPTION: Shifts the items at and after an index to the right and increases the size by the number of 
+			spaces opened. The opened spaces are left uninitialized. There must be capacity for the new spaces.
+		PARAMETERS:
+			unsigned int _index, the index to open the spaces at.
+			unsigned int _count, the number of spaces to open.
+	*/
+	void OpenSpace(unsigned int _index, unsigned int _count);
+	void OpenSpace(unsigned int _index, unsigned int _count, std::true_type);
+	void OpenSpace(unsigned int _index, unsigned int _count, std::false_type);
+
+	/*
+		DESCRIPTION: Destroys items at an index and shifts the items after them to the left to fill the space.
+		PARAMETERS:
+			unsigned int _index, the index of the first item to remove.
+			unsigned int _count, the number of items to remove.
+	*/
+	void CloseSpace(unsigned int _index, unsigned int _count);
+	void CloseSpace(unsigned int _index, unsigned int _count, std::true_type);
+	void CloseSpace(unsigned int _index, unsigned int _count, std::false_type);
+
 public:
 	// FUNCTIONS
 
@@ -38,9 +172,16 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided array.
 		PARAMETERS:
-			const DynamicArray<Type>& _array, the array to copy.
+			const DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array, the array to copy.
+	*/
+	DynamicArray(const DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array);
+
+	/*
+		DESCRIPTION: Takes the storage of the provided array, leaving it empty.
+		PARAMETERS:
+			DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>&& _array, the array to move.
 	*/
-	DynamicArray(const DynamicArray<Type>& _array);
+	DynamicArray(DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>&& _array);
 
 	/*
 		DESCRIPTION: Deallocates the array.
@@ -50,9 +191,16 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided array.
 		PARAMETERS:
-			const DynamicArray<Type>& _array, the array to copy.
+			const DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array, the array to copy.
+	*/
+	DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& operator=(const DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array);
+
+	/*
+		DESCRIPTION: Deallocates the array and takes the storage of the provided array, leaving it empty.
+		PARAMETERS:
+			DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>&& _array, the array to move.
 	*/
-	DynamicArray<Type>& operator=(const DynamicArray<Type>& _array);
+	DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& operator=(DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>&& _array);
 
 	/*
 		DESCRIPTION: Returns the item at an index.
@@ -75,6 +223,29 @@ public:
 	*/
 	void Append(const Type& _data);
 
+	/*
+		DESCRIPTION: Moves an item to the end of the array.
+		PARAMETERS:
+			Type&& _data, the item to add.
+	*/
+	void Append(Type&& _data);
+
+	/*
+		DESCRIPTION: Constructs an item at the end of the array.
+		PARAMETERS:
+			Args&&... _args, the arguments passed to the constructor of the item.
+	*/
+	template<typename... Args>
+	void EmplaceBack(Args&&... _args);
+
+	/*
+		DESCRIPTION: Adds items to the end of the array, growing the array at most once.
+		PARAMETERS:
+			const Type* _items, the items to add. They may be items of the array.
+			unsigned int _count, the number of items to add.
+	*/
+	void AppendRange(const Type* _items, unsigned int _count);
+
 	/*
 		DESCRIPTION: Inserts an item at an index of the array.
 		PARAMETERS:
@@ -83,6 +254,32 @@ public:
 	*/
 	void Insert(unsigned int _index, const Type& _data);
 
+	/*
+		DESCRIPTION: Moves an item into an index of the array.
+		PARAMETERS:
+			unsigned int _index, the index where the item is to be inserted.
+			Type&& _data, the item to insert.
+	*/
+	void Insert(unsigned int _index, Type&& _data);
+
+	/*
+		DESCRIPTION: Constructs an item at an index of the array.
+		PARAMETERS:
+			unsigned int _index, the index where the item is to be constructed.
+			Args&&... _args, the arguments passed to the constructor of the item.
+	*/
+	template<typename... Args>
+	void Emplace(unsigned int _index, Args&&... _args);
+
+	/*
+		DESCRIPTION: Inserts items at an index of the array, shifting the items after the index only once.
+		PARAMETERS:
+			unsigned int _index, the index where the first item is to be inserted.
+			const Type* _items, the items to insert. Must not point into the array.
+			unsigned int _count, the number of items to insert.
+	*/
+	void InsertRange(unsigned int _index, const Type* _items, unsigned int _count);
+
 	/*
 		DESCRIPTION: Removes the item at an index of the array.
 		PARAMETERS:
@@ -90,6 +287,50 @@ public:
 	*/
 	void Remove(unsigned int _index);
 
+	/*
+		DESCRIPTION: Removes items at an index of the array, shifting the items after them only once.
+		PARAMETERS:
+			unsigned int _index, the index of the first item to remove.
+			unsigned int _count, the number of items to remove.
+	*/
+	void RemoveRange(unsigned int _index, unsigned int _count);
+
+	/*
+		DESCRIPTION: Removes the last item of the array. No items are shifted, so the array can be used as a stack.
+	*/
+	inline void RemoveLast();
+
+	/*
+		DESCRIPTION: Removes the item at an index of the array by moving the last item into its place. The order of 
+			the items is not kept.
+		PARAMETERS:
+			unsigned int _index, the index of the item to remove.
+		RETURNS: bool - If the last item was moved to the index. When it was, its old index is the new Size().
+	*/
+	bool SwapRemove(unsigned int _index);
+
+	/*
+		DESCRIPTION: Removes the items at several indices of the array, filling each hole with the last item. The 
+			indices are removed from the largest to the smallest, so an item that is to be removed is never moved.
+		PARAMETERS:
+			const unsigned int* _indices, the indices of the items to remove, sorted from smallest to largest 
+				without repeats.
+			unsigned int _count, the number of indices.
+	*/
+	void SwapRemove(const unsigned int* _indices, unsigned int _count);
+
+	/*
+		DESCRIPTION: Removes the items at several indices of the array, filling each hole with the last item, and 
+			reports every item that moves so that handles to the items can be updated.
+		PARAMETERS:
+			const unsigned int* _indices, the indices of the items to remove, sorted from smallest to largest 
+				without repeats.
+			unsigned int _count, the number of indices.
+			MoveCallback _onMove, called as _onMove(unsigned int from, unsigned int to) after an item moves.
+	*/
+	template<typename MoveCallback>
+	void SwapRemove(const unsigned int* _indices, unsigned int _count, MoveCallback _onMove);
+
 	/*
 		DESCRIPTION: Returns if an item is in the array.
 		PARAMETERS:
@@ -99,7 +340,32 @@ public:
 	bool Find(const Type& _data);
 
 	/*
-		DESCRIPTION: Removes all the items in the array.
+		DESCRIPTION: Returns if an item is in the array.
+		PARAMETERS:
+			const Type& _data, the item to find.
+		RETURNS: bool - If the item is in the array.
+	*/
+	inline bool Contains(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Returns the index of the first item equal to the provided item.
+		PARAMETERS:
+			const Type& _data, the item to find.
+		RETURNS: unsigned int - The index of the item, or Size() if the item is not in the array.
+	*/
+	inline unsigned int IndexOf(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Returns the number of items equal to the provided item.
+		PARAMETERS:
+			const Type& _data, the item to count.
+		RETURNS: unsigned int - The number of matching items.
+	*/
+	inline unsigned int Count(const Type& _data) const;
+
+	/*
+		DESCRIPTION: Removes all the items in the array and deallocates its memory. The capacity returns to 
+			InlineCapacity.
 	*/
 	void Clear();
 
@@ -116,7 +382,9 @@ public:
 	inline unsigned int Capacity() const;
 
 	/*
-		DESCRIPTION: Reserves the amount memory needed for the desired capacity. 
+		DESCRIPTION: Reserves the amount memory needed for the desired capacity. The new space is not initialized.
+			A capacity less than the size removes the items that no longer fit. The capacity is never less than 
+			InlineCapacity.
 		PARAMETERS:
 			unsigned int _newCapacity, the desired capacity.
 	*/
@@ -128,174 +396,504 @@ public:
 	inline void ShrinkToFit();
 };
 
-template<typename Type>
-DynamicArray<Type>::DynamicArray() :
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DynamicArray() :
 	m_data(nullptr),
 	m_size(0),
-	m_capacity(0)
+	m_capacity(InlineCapacity)
 {
+	m_data = m_inlineBuffer.Data();
 }
 
-template<typename Type>
-DynamicArray<Type>::DynamicArray(const DynamicArray<Type>& _array) :
-	m_data(new Type[_array.m_capacity]),
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DynamicArray(const DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array) :
+	m_data(AllocateItems(_array.m_capacity)),
 	m_size(_array.m_size),
 	m_capacity(_array.m_capacity)
 {
-	memcpy_s(m_data, m_size, _array.m_data, m_size);
+	CopyItems(m_data, _array.m_data, m_size);
 }
 
-template<typename Type>
-DynamicArray<Type>::~DynamicArray()
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DynamicArray(DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>&& _array) :
+	m_data(nullptr),
+	m_size(0),
+	m_capacity(InlineCapacity)
 {
-	delete[] m_data;
-	m_data = nullptr;
-	m_size = m_capacity = 0;
+	m_data = m_inlineBuffer.Data();
+	TakeItems(_array);
 }
 
-template<typename Type>
-DynamicArray<Type>& DynamicArray<Type>::operator=(const DynamicArray<Type>& _array)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::~DynamicArray()
+{
+	Clear();
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::operator=(const DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array)
 {
 	// Ensure we're not assigning to ourself.
-	if (this != &_array)
+	if (this == &_array)
 		return *this;
 
-	delete[] m_data;
+	Clear();
 
+	m_data = AllocateItems(_array.m_capacity);
 	m_size = _array.m_size;
 	m_capacity = _array.m_capacity;
 
-	m_data = new Type[m_capacity];
-	memcpy_s(m_data, m_size, _array.m_data, m_size);
+	CopyItems(m_data, _array.m_data, m_size);
 
 	return *this;
 }
 
-template<typename Type>
-Type& DynamicArray<Type>::operator[](unsigned int _index)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::operator=(DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>&& _array)
+{
+	// Ensure we're not assigning to ourself.
+	if (this == &_array)
+		return *this;
+
+	Clear();
+	TakeItems(_array);
+
+	return *this;
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+Type& DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::operator[](unsigned int _index)
 {
 	return m_data[_index];
 }
 
-template<typename Type>
-const Type& DynamicArray<Type>::operator[](unsigned int _index) const
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+const Type& DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::operator[](unsigned int _index) const
 {
 	return m_data[_index];
 }
 
-template<typename Type>
-void DynamicArray<Type>::Append(const Type& _data)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Append(const Type& _data)
 {
-	if (m_size == m_capacity)
+	EmplaceBack(_data);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Append(Type&& _data)
+{
+	EmplaceBack(std::move(_data));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+template<typename... Args>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::EmplaceBack(Args&&... _args)
+{
+	if (m_size < m_capacity)
 	{
-		if (m_capacity > 0)
-			Reserve(m_capacity << 1); // Double the array capacity.
-		else
-			Reserve(1);
+		new (m_data + m_size) Type(std::forward<Args>(_args)...);
+		++m_size;
+		return;
 	}
 
-	m_data[m_size++] = _data;
+	// The arguments may refer to an item in the array, so the new item is constructed before the old items are 
+	// moved out of the way.
+	unsigned int newCapacity = NextCapacity(m_size + 1);
+	Type* newData = AllocateItems(newCapacity);
+
+	new (newData + m_size) Type(std::forward<Args>(_args)...);
+	MoveItems(newData, m_data, m_size);
+	DeallocateItems(m_data, m_capacity);
+
+	m_data = newData;
+	m_capacity = newCapacity;
+	++m_size;
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::AppendRange(const Type* _items, unsigned int _count)
+{
+	InsertRange(m_size, _items, _count);
 }
 
-template<typename Type>
-void DynamicArray<Type>::Insert(unsigned int _index, const Type& _data)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Insert(unsigned int _index, const Type& _data)
+{
+	Emplace(_index, _data);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Insert(unsigned int _index, Type&& _data)
+{
+	Emplace(_index, std::move(_data));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+template<typename... Args>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Emplace(unsigned int _index, Args&&... _args)
 {
 	assert(_index <= m_size);
 
-	if (m_size == m_capacity)
+	if (_index == m_size)
 	{
-		if (m_capacity > 0)
-			Reserve(m_capacity << 1); // Double the array capacity.
-		else
-			Reserve(1);
+		EmplaceBack(std::forward<Args>(_args)...);
+		return;
 	}
 
-	if (_index < m_size)
+	// The arguments may refer to an item in the array, so the new item is constructed before any items are shifted.
+	Type item(std::forward<Args>(_args)...);
+
+	GrowIfFull();
+	OpenSpace(_index, 1);
+	new (m_data + _index) Type(std::move(item));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::InsertRange(unsigned int _index, const Type* _items, unsigned int _count)
+{
+	assert(_index <= m_size);
+
+	if (_count == 0)
+		return;
+
+	if (m_size + _count <= m_capacity)
 	{
-		// Move the array items to the right to make space for the new item.
-		for (unsigned int i = m_size - 1; i >= _index; --i)
-		{
-			m_data[i + 1] = m_data[i];
-
-			if (i == 0)
-				break;
-		}
+		OpenSpace(_index, _count);
+		CopyItems(m_data + _index, _items, _count);
+		return;
 	}
 
-	m_data[_index] = _data;
-	++m_size;
+	// The items are copied into the new memory around the space for the new items, so nothing is shifted.
+	unsigned int newCapacity = NextCapacity(m_size + _count);
+	Type* newData = AllocateItems(newCapacity);
+
+	CopyItems(newData + _index, _items, _count);
+	MoveItems(newData, m_data, _index);
+	MoveItems(newData + _index + _count, m_data + _index, m_size - _index);
+	DeallocateItems(m_data, m_capacity);
+
+	m_data = newData;
+	m_size += _count;
+	m_capacity = newCapacity;
 }
 
-template<typename Type>
-void DynamicArray<Type>::Remove(unsigned int _index)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Remove(unsigned int _index)
 {
 	assert(_index < m_size);
 
-	for (unsigned int i = _index; i < m_size; ++i)
-		m_data[i] = m_data[i + 1];
+	CloseSpace(_index, 1);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::RemoveLast()
+{
+	assert(m_size > 0);
 
 	--m_size;
+	DestroyItems(m_data + m_size, 1);
 }
 
-template<typename Type>
-bool DynamicArray<Type>::Find(const Type& _data)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::RemoveRange(unsigned int _index, unsigned int _count)
 {
-	for (unsigned int i = 0; i < m_size; ++i)
-		if (m_data[i] == _data)
-			return true;
+	assert(_index <= m_size && _count <= m_size - _index);
 
-	return false;
+	CloseSpace(_index, _count);
 }
 
-template<typename Type>
-void DynamicArray<Type>::Clear()
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+bool DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::SwapRemove(unsigned int _index)
 {
-	delete[] m_data;
-	m_data = nullptr;
-	m_size = m_capacity = 0;
+	assert(_index < m_size);
+
+	--m_size;
+
+	// The last item is removed without moving anything.
+	if (_index == m_size)
+	{
+		DestroyItems(m_data + m_size, 1);
+		return false;
+	}
+
+	m_data[_index] = std::move(m_data[m_size]);
+	DestroyItems(m_data + m_size, 1);
+	return true;
 }
 
-template<typename Type>
-unsigned int DynamicArray<Type>::Size() const
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::SwapRemove(const unsigned int* _indices, unsigned int _count)
+{
+	SwapRemove(_indices, _count, [](unsigned int, unsigned int) {});
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+template<typename MoveCallback>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::SwapRemove(const unsigned int* _indices, unsigned int _count, MoveCallback _onMove)
+{
+	// Every index larger than the current one is already removed, so the last item is never one to remove.
+	for (unsigned int i = _count; i > 0; --i)
+	{
+		assert(i == _count || _indices[i - 1] < _indices[i]);
+
+		if (SwapRemove(_indices[i - 1]))
+			_onMove(m_size, _indices[i - 1]);
+	}
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+bool DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Find(const Type& _data)
+{
+	return Contains(_data);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+bool DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Contains(const Type& _data) const
+{
+	return Search::Contains(m_data, m_size, _data);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+unsigned int DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::IndexOf(const Type& _data) const
+{
+	return Search::IndexOf(m_data, m_size, _data);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+unsigned int DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Count(const Type& _data) const
+{
+	return Search::Count(m_data, m_size, _data);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Clear()
+{
+	DestroyItems(m_data, m_size);
+	DeallocateItems(m_data, m_capacity);
+	m_data = m_inlineBuffer.Data();
+	m_size = 0;
+	m_capacity = InlineCapacity;
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+unsigned int DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Size() const
 {
 	return m_size;
 }
 
-template<typename Type>
-unsigned int DynamicArray<Type>::Capacity() const
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+unsigned int DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Capacity() const
 {
 	return m_capacity;
 }
 
-template<typename Type>
-void DynamicArray<Type>::Reserve(unsigned int _newCapacity)
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::Reserve(unsigned int _newCapacity)
 {
+	// Remove the items that no longer fit.
+	if (m_size > _newCapacity)
+	{
+		DestroyItems(m_data + _newCapacity, m_size - _newCapacity);
+		m_size = _newCapacity;
+	}
+
+	if (_newCapacity < InlineCapacity)
+		_newCapacity = InlineCapacity;
+
 	if (_newCapacity == m_capacity)
 		return;
 
-	if (_newCapacity < m_capacity && m_size > _newCapacity)
-		m_size = _newCapacity;
+	Type* temp = AllocateItems(_newCapacity);
 
+	// The old items are about to be deallocated, so they can be moved instead of copied.
+	MoveItems(temp, m_data, m_size);
+	DeallocateItems(m_data, m_capacity);
+
+	m_data = temp;
 	m_capacity = _newCapacity;
-	
-	if (m_capacity == 0)
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::ShrinkToFit()
+{
+	Reserve(m_size);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+Type* DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::AllocateItems(unsigned int _capacity)
+{
+	if (_capacity <= InlineCapacity)
+		return m_inlineBuffer.Data();
+
+	return m_allocator.Allocate(_capacity);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DeallocateItems(Type* _items, unsigned int _capacity)
+{
+	if (_items != m_inlineBuffer.Data())
+		m_allocator.Deallocate(_items, _capacity);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::TakeItems(DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>& _array)
+{
+	assert(m_size == 0 && m_data == m_inlineBuffer.Data());
+
+	if (_array.m_data == _array.m_inlineBuffer.Data())
 	{
-		delete[] m_data;
-		m_data = nullptr;
-		return;
+		// Items in an inline buffer cannot be taken, so they are moved into this array's inline buffer.
+		MoveItems(m_data, _array.m_data, _array.m_size);
+		m_size = _array.m_size;
 	}
+	else
+	{
+		m_data = _array.m_data;
+		m_size = _array.m_size;
+		m_capacity = _array.m_capacity;
 
-	Type* temp = new Type[_newCapacity];
+		_array.m_data = _array.m_inlineBuffer.Data();
+		_array.m_capacity = InlineCapacity;
+	}
 
-	for (unsigned int i = 0; i < m_size; ++i)
-		temp[i] = m_data[i];
+	_array.m_size = 0;
+}
 
-	delete[] m_data;
-	m_data = temp;
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::CopyItems(Type* _destination, const Type* _source, unsigned int _count)
+{
+	CopyItems(_destination, _source, _count, std::is_trivially_copyable<Type>());
 }
 
-template<typename Type>
-void DynamicArray<Type>::ShrinkToFit()
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::CopyItems(Type* _destination, const Type* _source, unsigned int _count, std::true_type)
 {
-	Reserve(m_size);
+	if (_count > 0)
+		std::memcpy(_destination, _source, _count * sizeof(Type));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::CopyItems(Type* _destination, const Type* _source, unsigned int _count, std::false_type)
+{
+	for (unsigned int i = 0; i < _count; ++i)
+		new (_destination + i) Type(_source[i]);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::MoveItems(Type* _destination, Type* _source, unsigned int _count)
+{
+	MoveItems(_destination, _source, _count, std::is_trivially_copyable<Type>());
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::MoveItems(Type* _destination, Type* _source, unsigned int _count, std::true_type)
+{
+	if (_count > 0)
+		std::memcpy(_destination, _source, _count * sizeof(Type));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::MoveItems(Type* _destination, Type* _source, unsigned int _count, std::false_type)
+{
+	for (unsigned int i = 0; i < _count; ++i)
+	{
+		new (_destination + i) Type(std::move(_source[i]));
+		_source[i].~Type();
+	}
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DestroyItems(Type* _items, unsigned int _count)
+{
+	DestroyItems(_items, _count, std::is_trivially_destructible<Type>());
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DestroyItems(Type*, unsigned int, std::true_type)
+{
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::DestroyItems(Type* _items, unsigned int _count, std::false_type)
+{
+	for (unsigned int i = 0; i < _count; ++i)
+		_items[i].~Type();
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+unsigned int DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::NextCapacity(unsigned int _size) const
+{
+	return GrowthPolicy::NextCapacity(m_capacity, _size);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::GrowIfFull()
+{
+	if (m_size == m_capacity)
+		Reserve(NextCapacity(m_size + 1));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::OpenSpace(unsigned int _index, unsigned int _count)
+{
+	assert(_index <= m_size);
+	assert(m_size + _count <= m_capacity);
+
+	OpenSpace(_index, _count, std::is_trivially_copyable<Type>());
+	m_size += _count;
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::OpenSpace(unsigned int _index, unsigned int _count, std::true_type)
+{
+	if (_index < m_size)
+		std::memmove(m_data + _index + _count, m_data + _index, (m_size - _index) * sizeof(Type));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::OpenSpace(unsigned int _index, unsigned int _count, std::false_type)
+{
+	// Items that land past the end of the array move into uninitialized memory.
+	unsigned int end = m_size + _count;
+	unsigned int constructedEnd = (_index + _count > m_size) ? _index + _count : m_size;
+
+	for (unsigned int i = end; i > constructedEnd; --i)
+		new (m_data + i - 1) Type(std::move(m_data[i - 1 - _count]));
+
+	// The rest move to the right over items that were already moved from.
+	for (unsigned int i = constructedEnd - _count; i > _index; --i)
+		m_data[i - 1 + _count] = std::move(m_data[i - 1]);
+
+	// Leave the opened spaces uninitialized for the new items.
+	DestroyItems(m_data + _index, ((_index + _count < m_size) ? _index + _count : m_size) - _index);
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::CloseSpace(unsigned int _index, unsigned int _count)
+{
+	assert(_index + _count <= m_size);
+
+	// Nothing to remove. Shifting would move each item onto itself.
+	if (_count == 0)
+		return;
+
+	CloseSpace(_index, _count, std::is_trivially_copyable<Type>());
+	m_size -= _count;
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::CloseSpace(unsigned int _index, unsigned int _count, std::true_type)
+{
+	if (_index + _count < m_size)
+		std::memmove(m_data + _index, m_data + _index + _count, (m_size - _index - _count) * sizeof(Type));
+}
+
+template<typename Type, unsigned int InlineCapacity, typename GrowthPolicy, template<typename> class Allocator>
+void DynamicArray<Type, InlineCapacity, GrowthPolicy, Allocator>::CloseSpace(unsigned int _index, unsigned int _count, std::false_type)
+{
+	// Move the array items to the left to fill the space of the removed items.
+	for (unsigned int i = _index + _count; i < m_size; ++i)
+		m_data[i - _count] = std::move(m_data[i]);
+
+	DestroyItems(m_data + m_size - _count, _count);
 }
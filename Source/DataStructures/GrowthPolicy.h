@@ -0,0 +1,100 @@
+/*
+	FILE: GrowthPolicy.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Growth policies for contiguous data structures. A growth policy picks the capacity to grow to when
+		there is no space for more items. The policies are:
+		- DoublingGrowth: Doubles the capacity (1, 2, 4, 8, ...). The fewest reallocations, but up to half of the
+			memory may be unused.
+		- OneAndHalfGrowth: Grows the capacity by half (1, 2, 3, 4, 6, 9, 13, ...). More reallocations, but at most
+			a third of the memory is unused.
+		- FixedStepGrowth: Grows the capacity by a fixed number of items. Reallocates once per step, so Append() is
+			O(N) on average, but at most one step of memory is unused.
+*/
+
+#pragma once
+
+#include <limits> // Used for the largest capacity, which every policy stops growing at instead of wrapping around.
+
+/*
+	DESCRIPTION: Doubles the capacity until the items fit.
+*/
+struct DoublingGrowth
+{
+	/*
+		DESCRIPTION: Returns the capacity to grow to.
+		PARAMETERS:
+			unsigned int _capacity, the current capacity.
+			unsigned int _size, the number of items that need to fit. Greater than _capacity.
+		RETURNS: unsigned int - The new capacity, at least _size. The largest unsigned int if growing would pass it.
+	*/
+	static inline unsigned int NextCapacity(unsigned int _capacity, unsigned int _size)
+	{
+		unsigned int capacity = (_capacity > 0) ? _capacity : 1;
+
+		while (capacity < _size)
+		{
+			if (capacity > std::numeric_limits<unsigned int>::max() >> 1)
+				return std::numeric_limits<unsigned int>::max();
+
+			capacity <<= 1;
+		}
+
+		return capacity;
+	}
+};
+
+/*
+	DESCRIPTION: Grows the capacity by half, and at least by one, until the items fit.
+*/
+struct OneAndHalfGrowth
+{
+	/*
+		DESCRIPTION: Returns the capacity to grow to.
+		PARAMETERS:
+			unsigned int _capacity, the current capacity.
+			unsigned int _size, the number of items that need to fit. Greater than _capacity.
+		RETURNS: unsigned int - The new capacity, at least _size. The largest unsigned int if growing would pass it.
+	*/
+	static inline unsigned int NextCapacity(unsigned int _capacity, unsigned int _size)
+	{
+		unsigned int capacity = _capacity;
+
+		while (capacity < _size)
+		{
+			const unsigned int step = (capacity > 1) ? capacity >> 1 : 1;
+
+			if (capacity > std::numeric_limits<unsigned int>::max() - step)
+				return std::numeric_limits<unsigned int>::max();
+
+			capacity += step;
+		}
+
+		return capacity;
+	}
+};
+
+/*
+	DESCRIPTION: Grows the capacity to the next multiple of a fixed step that the items fit in.
+*/
+template<unsigned int Step>
+struct FixedStepGrowth
+{
+	static_assert(Step > 0, "FixedStepGrowth needs a step of at least one item.");
+
+	/*
+		DESCRIPTION: Returns the capacity to grow to.
+		PARAMETERS:
+			unsigned int, the current capacity. Not needed, since the step does not depend on it.
+			unsigned int _size, the number of items that need to fit. Greater than the current capacity.
+		RETURNS: unsigned int - The new capacity, at least _size. The largest unsigned int if growing would pass it.
+	*/
+	static inline unsigned int NextCapacity(unsigned int, unsigned int _size)
+	{
+		if (_size > std::numeric_limits<unsigned int>::max() - (Step - 1))
+			return std::numeric_limits<unsigned int>::max();
+
+		return ((_size + Step - 1) / Step) * Step;
+	}
+};
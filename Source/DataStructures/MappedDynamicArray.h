@@ -0,0 +1,476 @@
+/*
+	FILE: MappedDynamicArray.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: A dynamic array whose storage is a memory mapped file. The items are the file, so an array that was
+		closed can be reopened without reading or copying any items, the operating system pages them in as they are
+		used. Only trivially copyable types can be stored, since the items are saved as raw memory. The file holds a
+		header, which records the item size and the number of items, followed by the items. The capacity is the
+		number of items the file has room for. Memory mapping uses POSIX, so the array is only available on
+		Unix-like systems. The benefits are:
+		- Open(): O(1), no matter how many items the file holds.
+		- Append(): On average O(1), worst case O(N) to grow the file. On Linux, growing remaps the file without
+			copying the items.
+*/
+
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+	#define MAPPED_DYNAMIC_ARRAY_SUPPORTED
+#endif
+
+#if defined(MAPPED_DYNAMIC_ARRAY_SUPPORTED)
+
+#include <assert.h>
+#include <cstdint> // Used for the fixed size integer types in the file header.
+#include <cstring> // Used for std::memcpy.
+#include <new> // Used for std::bad_alloc.
+#include <type_traits> // Used to check that the type is trivially copyable.
+
+#include <fcntl.h> // Used for open.
+#include <sys/mman.h> // Used for mmap, mremap, munmap, and msync.
+#include <sys/stat.h> // Used for fstat.
+#include <unistd.h> // Used for close and ftruncate.
+
+#include "GrowthPolicy.h"
+
+/*
+	DESCRIPTION: A dynamically expanding array of contiguous storage, saved in a memory mapped file.
+*/
+template<typename Type, typename GrowthPolicy = DoublingGrowth>
+class MappedDynamicArray
+{
+private:
+	static_assert(std::is_trivially_copyable<Type>::value, "MappedDynamicArray can only store trivially copyable types.");
+	static_assert(alignof(Type) <= 64, "MappedDynamicArray does not support types aligned to more than 64 bytes.");
+
+	/*
+		DESCRIPTION: The start of the file. The items start right after the header, 64 bytes into the file.
+	*/
+	struct Header
+	{
+		uint64_t magic; // Identifies the file as a mapped array.
+		uint32_t itemSize; // The size of each item, so that a file isn't opened as an array of a different type.
+		uint32_t size; // Number of items in the array.
+		unsigned char reserved[48]; // Pads the header to 64 bytes, so that the items are aligned to a cache line.
+	};
+
+	static_assert(sizeof(Header) == 64, "The header must be 64 bytes.");
+
+	// DATA MEMBERS
+
+	static constexpr uint64_t MAGIC = 0x59415252414E5944ull; // "DYNARRAY" in little endian bytes.
+
+	int m_file; // The file descriptor of the open file, or -1 when no file is open.
+	Header* m_header; // The mapping of the whole file, which starts with the header.
+	Type* m_data; // The items, just after the header.
+	unsigned int m_capacity; // Number of spaces for items in the file
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Returns the size of the file that holds a number of items.
+		PARAMETERS:
+			unsigned int _capacity, the number of items.
+		RETURNS: size_t - The file size in bytes.
+	*/
+	static inline size_t FileSize(unsigned int _capacity);
+
+	/*
+		DESCRIPTION: Resizes the file and its mapping to hold a number of items. Throws std::bad_alloc if the file or
+			its mapping cannot be resized. If the old mapping was already released, the array is closed first.
+		PARAMETERS:
+			unsigned int _capacity, the number of items.
+	*/
+	void Resize(unsigned int _capacity);
+
+	/*
+		DESCRIPTION: Grows the capacity of the array if there is no space for the items.
+		PARAMETERS:
+			unsigned int _size, the number of items that need space.
+	*/
+	inline void GrowToFit(unsigned int _size);
+
+public:
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Constructs an array without a file. Open() must be called before the array is used.
+	*/
+	MappedDynamicArray();
+
+	/*
+		DESCRIPTION: Constructs an array and opens a file. IsOpen() tells if the file was opened.
+		PARAMETERS:
+			const char* _path, the path of the file to open.
+	*/
+	explicit MappedDynamicArray(const char* _path);
+
+	MappedDynamicArray(const MappedDynamicArray& _array) = delete;
+	MappedDynamicArray& operator=(const MappedDynamicArray& _array) = delete;
+
+	/*
+		DESCRIPTION: Closes the file. The items stay in the file.
+	*/
+	~MappedDynamicArray();
+
+	/*
+		DESCRIPTION: Opens a file, creating an empty array in it if it does not exist. Any open file is closed first.
+		PARAMETERS:
+			const char* _path, the path of the file to open.
+		RETURNS: bool - If the file was opened. A file that is not a mapped array of this type is not opened.
+	*/
+	bool Open(const char* _path);
+
+	/*
+		DESCRIPTION: Unmaps and closes the file. The items stay in the file.
+	*/
+	void Close();
+
+	/*
+		DESCRIPTION: Returns if a file is open.
+		RETURNS: bool - If a file is open.
+	*/
+	inline bool IsOpen() const;
+
+	/*
+		DESCRIPTION: Writes the items to the file and waits until they are on the disk. The operating system writes
+			them eventually without this.
+		RETURNS: bool - If the items were written.
+	*/
+	bool Flush();
+
+	/*
+		DESCRIPTION: Returns the item at an index.
+		PARAMETERS:
+			unsigned int _index, the index of the item.
+	*/
+	inline Type& operator[](unsigned int _index);
+
+	/*
+		DESCRIPTION: Returns the item at an index.
+		PARAMETERS:
+			unsigned int _index, the index of the item.
+	*/
+	inline const Type& operator[](unsigned int _index) const;
+
+	/*
+		DESCRIPTION: Adds an item to the end of the array.
+		PARAMETERS:
+			const Type& _data, the item to add.
+	*/
+	void Append(const Type& _data);
+
+	/*
+		DESCRIPTION: Adds items to the end of the array, growing the file at most once.
+		PARAMETERS:
+			const Type* _items, the items to add. May be items of the array.
+			unsigned int _count, the number of items to add.
+	*/
+	void AppendRange(const Type* _items, unsigned int _count);
+
+	/*
+		DESCRIPTION: Removes the last item of the array.
+	*/
+	inline void RemoveLast();
+
+	/*
+		DESCRIPTION: Removes all the items in the array and shrinks the file to just the header.
+	*/
+	void Clear();
+
+	/*
+		DESCRIPTION: Returns the number of items stored in the array.
+		RETURNS: unsigned int - The size of the array.
+	*/
+	inline unsigned int Size() const;
+
+	/*
+		DESCRIPTION: Returns the number of items the file has room for before it needs to grow.
+		RETURNS: unsigned int - The capacity of the array.
+	*/
+	inline unsigned int Capacity() const;
+
+	/*
+		DESCRIPTION: Resizes the file for the desired capacity. A capacity less than the size removes the items that
+			no longer fit.
+		PARAMETERS:
+			unsigned int _newCapacity, the desired capacity.
+	*/
+	void Reserve(unsigned int _newCapacity);
+
+	/*
+		DESCRIPTION: Shrinks the file so that it only holds the items in the array.
+	*/
+	inline void ShrinkToFit();
+};
+
+template<typename Type, typename GrowthPolicy>
+MappedDynamicArray<Type, GrowthPolicy>::MappedDynamicArray() :
+	m_file(-1),
+	m_header(nullptr),
+	m_data(nullptr),
+	m_capacity(0)
+{
+}
+
+template<typename Type, typename GrowthPolicy>
+MappedDynamicArray<Type, GrowthPolicy>::MappedDynamicArray(const char* _path) :
+	MappedDynamicArray()
+{
+	Open(_path);
+}
+
+template<typename Type, typename GrowthPolicy>
+MappedDynamicArray<Type, GrowthPolicy>::~MappedDynamicArray()
+{
+	Close();
+}
+
+template<typename Type, typename GrowthPolicy>
+bool MappedDynamicArray<Type, GrowthPolicy>::Open(const char* _path)
+{
+	Close();
+
+	int file = open(_path, O_RDWR | O_CREAT, 0644);
+	if (file < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(file, &info) != 0)
+	{
+		close(file);
+		return false;
+	}
+
+	// A new file gets an empty array.
+	const bool isNew = info.st_size == 0;
+
+	if (isNew)
+	{
+		if (ftruncate(file, FileSize(0)) != 0)
+		{
+			close(file);
+			return false;
+		}
+
+		info.st_size = FileSize(0);
+	}
+
+	// The file must hold a header and a whole number of items.
+	if (static_cast<size_t>(info.st_size) < FileSize(0) || (info.st_size - FileSize(0)) % sizeof(Type) != 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* mapping = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	if (mapping == MAP_FAILED)
+	{
+		close(file);
+		return false;
+	}
+
+	Header* header = static_cast<Header*>(mapping);
+	const unsigned int capacity = static_cast<unsigned int>((info.st_size - FileSize(0)) / sizeof(Type));
+
+	if (isNew)
+	{
+		std::memset(header, 0, sizeof(Header));
+		header->magic = MAGIC;
+		header->itemSize = sizeof(Type);
+	}
+	else if (header->magic != MAGIC || header->itemSize != sizeof(Type) || header->size > capacity)
+	{
+		munmap(mapping, info.st_size);
+		close(file);
+		return false;
+	}
+
+	m_file = file;
+	m_header = header;
+	m_data = reinterpret_cast<Type*>(reinterpret_cast<unsigned char*>(mapping) + sizeof(Header));
+	m_capacity = capacity;
+
+	return true;
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::Close()
+{
+	if (!IsOpen())
+		return;
+
+	munmap(m_header, FileSize(m_capacity));
+	close(m_file);
+
+	m_file = -1;
+	m_header = nullptr;
+	m_data = nullptr;
+	m_capacity = 0;
+}
+
+template<typename Type, typename GrowthPolicy>
+bool MappedDynamicArray<Type, GrowthPolicy>::IsOpen() const
+{
+	return m_file >= 0;
+}
+
+template<typename Type, typename GrowthPolicy>
+bool MappedDynamicArray<Type, GrowthPolicy>::Flush()
+{
+	if (!IsOpen())
+		return false;
+
+	return msync(m_header, FileSize(m_capacity), MS_SYNC) == 0;
+}
+
+template<typename Type, typename GrowthPolicy>
+Type& MappedDynamicArray<Type, GrowthPolicy>::operator[](unsigned int _index)
+{
+	return m_data[_index];
+}
+
+template<typename Type, typename GrowthPolicy>
+const Type& MappedDynamicArray<Type, GrowthPolicy>::operator[](unsigned int _index) const
+{
+	return m_data[_index];
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::Append(const Type& _data)
+{
+	assert(IsOpen());
+
+	// The item is copied before the file grows, since it may be an item of the array.
+	Type item = _data;
+
+	GrowToFit(m_header->size + 1);
+	m_data[m_header->size++] = item;
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::AppendRange(const Type* _items, unsigned int _count)
+{
+	assert(IsOpen());
+
+	if (_count == 0)
+		return;
+
+	// The items may be part of the array, which can move when the file grows, so they are found again by index.
+	const bool isInArray = _items >= m_data && _items < m_data + m_header->size;
+	const size_t index = isInArray ? static_cast<size_t>(_items - m_data) : 0;
+
+	assert(!isInArray || index + _count <= m_header->size);
+
+	GrowToFit(m_header->size + _count);
+
+	if (isInArray)
+		_items = m_data + index;
+
+	std::memcpy(m_data + m_header->size, _items, _count * sizeof(Type));
+	m_header->size += _count;
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::RemoveLast()
+{
+	assert(IsOpen() && m_header->size > 0);
+
+	--m_header->size;
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::Clear()
+{
+	Reserve(0);
+}
+
+template<typename Type, typename GrowthPolicy>
+unsigned int MappedDynamicArray<Type, GrowthPolicy>::Size() const
+{
+	return IsOpen() ? m_header->size : 0;
+}
+
+template<typename Type, typename GrowthPolicy>
+unsigned int MappedDynamicArray<Type, GrowthPolicy>::Capacity() const
+{
+	return m_capacity;
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::Reserve(unsigned int _newCapacity)
+{
+	assert(IsOpen());
+
+	if (_newCapacity == m_capacity)
+		return;
+
+	// Remove the items that no longer fit.
+	if (m_header->size > _newCapacity)
+		m_header->size = _newCapacity;
+
+	Resize(_newCapacity);
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::ShrinkToFit()
+{
+	Reserve(Size());
+}
+
+template<typename Type, typename GrowthPolicy>
+size_t MappedDynamicArray<Type, GrowthPolicy>::FileSize(unsigned int _capacity)
+{
+	return sizeof(Header) + sizeof(Type) * static_cast<size_t>(_capacity);
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::Resize(unsigned int _capacity)
+{
+	const size_t oldSize = FileSize(m_capacity);
+	const size_t newSize = FileSize(_capacity);
+
+	// The file grows before the mapping, so that no part of the mapping is past the end of the file.
+	if (newSize > oldSize && ftruncate(m_file, newSize) != 0)
+		throw std::bad_alloc();
+
+#if defined(__linux__)
+	// Linux can move the mapping without copying the items.
+	void* mapping = mremap(m_header, oldSize, newSize, MREMAP_MAYMOVE);
+#else
+	munmap(m_header, oldSize);
+	void* mapping = mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+
+	// The old mapping is already gone, so the array is closed instead of being left pointing at it.
+	if (mapping == MAP_FAILED)
+	{
+		close(m_file);
+
+		m_file = -1;
+		m_header = nullptr;
+		m_data = nullptr;
+		m_capacity = 0;
+	}
+#endif
+
+	if (mapping == MAP_FAILED)
+		throw std::bad_alloc();
+
+	if (newSize < oldSize)
+		ftruncate(m_file, newSize);
+
+	m_header = static_cast<Header*>(mapping);
+	m_data = reinterpret_cast<Type*>(reinterpret_cast<unsigned char*>(mapping) + sizeof(Header));
+	m_capacity = _capacity;
+}
+
+template<typename Type, typename GrowthPolicy>
+void MappedDynamicArray<Type, GrowthPolicy>::GrowToFit(unsigned int _size)
+{
+	if (_size > m_capacity)
+		Resize(GrowthPolicy::NextCapacity(m_capacity, _size));
+}
+
+#endif
@@ -0,0 +1,192 @@
+/*
+	FILE: NodeAllocator.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Allocators for node-based data structures. An allocator hands out uninitialized memory for a single
+		item at a time. The data structure constructs and destroys its nodes in that memory. The allocators are:
+		- HeapAllocator: Every Allocate() and Deallocate() goes to the global heap.
+		- PoolAllocator: Items are carved out of slabs of contiguous memory. Deallocated items go on a free list and
+			are reused, so the global heap is only touched when every slab is full. ReleaseAll() frees every item 
+			in O(slabs) instead of O(items).
+*/
+
+#pragma once
+
+#include <assert.h>
+#include <cstddef> // Used for std::max_align_t.
+#include <new> // Used for ::operator new and ::operator delete.
+
+/*
+	DESCRIPTION: Allocates each item separately from the global heap.
+*/
+template<typename Type>
+class HeapAllocator
+{
+public:
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates memory for an item. The item is not constructed.
+		RETURNS: (Type*) Uninitialized memory for one item.
+	*/
+	inline Type* Allocate();
+
+	/*
+		DESCRIPTION: Returns the memory for an item to the global heap. The item must already be destroyed.
+		PARAMETERS:
+			Type* _item, memory returned by Allocate().
+	*/
+	inline void Deallocate(Type* _item);
+
+	/*
+		DESCRIPTION: Not supported. Items allocated from the global heap must be deallocated one at a time.
+		RETURNS: (bool) false, always.
+	*/
+	inline bool ReleaseAll();
+};
+
+/*
+	DESCRIPTION: Allocates items from slabs of contiguous memory and recycles them through a free list.
+*/
+template<typename Type>
+class PoolAllocator
+{
+private:
+	/*
+		DESCRIPTION: Storage for one item. While the item is not allocated, the storage links to the next free slot.
+	*/
+	union Slot
+	{
+		Slot* next; // The next free slot, or the previous slab when this is the first slot of a slab.
+		alignas(Type) unsigned char item[sizeof(Type)];
+	};
+
+	static_assert(alignof(Type) <= alignof(std::max_align_t), "PoolAllocator does not support over-aligned types.");
+
+	// DATA MEMBERS
+
+	Slot* m_slabs; // The most recently allocated slab. The first slot of each slab links to the previous slab.
+	Slot* m_freeList; // Slots that were deallocated and can be reused.
+	unsigned int m_slabUsed; // Number of slots handed out from the most recently allocated slab.
+	unsigned int m_slabSize; // Number of item slots in each slab.
+
+public:
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Constructs an allocator without allocating any memory.
+		PARAMETERS:
+			unsigned int _slabSize, the number of items each slab holds.
+	*/
+	explicit PoolAllocator(unsigned int _slabSize = 64);
+
+	PoolAllocator(const PoolAllocator& _allocator) = delete;
+	PoolAllocator& operator=(const PoolAllocator& _allocator) = delete;
+
+	/*
+		DESCRIPTION: Releases all slabs. Every item must already be destroyed.
+	*/
+	~PoolAllocator();
+
+	/*
+		DESCRIPTION: Allocates memory for an item. The item is not constructed.
+		RETURNS: (Type*) Uninitialized memory for one item.
+	*/
+	inline Type* Allocate();
+
+	/*
+		DESCRIPTION: Returns the memory for an item to the free list. The item must already be destroyed.
+		PARAMETERS:
+			Type* _item, memory returned by Allocate().
+	*/
+	inline void Deallocate(Type* _item);
+
+	/*
+		DESCRIPTION: Deallocates every item at once by releasing all slabs. Items are not destroyed, so this should 
+			only be used when the items have nothing to destroy or were already destroyed.
+		RETURNS: (bool) true, always.
+	*/
+	bool ReleaseAll();
+};
+
+template<typename Type>
+Type* HeapAllocator<Type>::Allocate()
+{
+	return static_cast<Type*>(::operator new(sizeof(Type)));
+}
+
+template<typename Type>
+void HeapAllocator<Type>::Deallocate(Type* _item)
+{
+	::operator delete(_item);
+}
+
+template<typename Type>
+bool HeapAllocator<Type>::ReleaseAll()
+{
+	return false;
+}
+
+template<typename Type>
+PoolAllocator<Type>::PoolAllocator(unsigned int _slabSize) :
+	m_slabs(nullptr),
+	m_freeList(nullptr),
+	m_slabUsed(_slabSize),
+	m_slabSize(_slabSize)
+{
+	assert(_slabSize > 0);
+}
+
+template<typename Type>
+PoolAllocator<Type>::~PoolAllocator()
+{
+	ReleaseAll();
+}
+
+template<typename Type>
+Type* PoolAllocator<Type>::Allocate()
+{
+	// Reuse a deallocated slot first.
+	if (m_freeList)
+	{
+		Slot* slot = m_freeList;
+		m_freeList = m_freeList->next;
+		return reinterpret_cast<Type*>(slot->item);
+	}
+
+	if (m_slabUsed == m_slabSize)
+	{
+		// All slabs are full. The first slot of the new slab links to the previous slab.
+		Slot* slab = static_cast<Slot*>(::operator new(sizeof(Slot) * (m_slabSize + 1)));
+		slab->next = m_slabs;
+		m_slabs = slab;
+		m_slabUsed = 0;
+	}
+
+	return reinterpret_cast<Type*>(m_slabs[1 + m_slabUsed++].item);
+}
+
+template<typename Type>
+void PoolAllocator<Type>::Deallocate(Type* _item)
+{
+	Slot* slot = reinterpret_cast<Slot*>(_item);
+	slot->next = m_freeList;
+	m_freeList = slot;
+}
+
+template<typename Type>
+bool PoolAllocator<Type>::ReleaseAll()
+{
+	while (m_slabs)
+	{
+		Slot* slab = m_slabs;
+		m_slabs = m_slabs->next;
+		::operator delete(slab);
+	}
+
+	m_freeList = nullptr;
+	m_slabUsed = m_slabSize;
+
+	return true;
+}
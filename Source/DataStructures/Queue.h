@@ -2,7 +2,7 @@
 	FILE: Queue.h
 	AUTHOR: Ozzie Mercado
 	CREATED: February 1, 2021
-	MODIFIED: February 1, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: A templated Queue data structure. The benefits of this Queue are:
 		- Enqueue(): On average O(1), worst case O(1).
 		- Dequeue(): On average O(1), worst case O(1).
@@ -12,10 +12,12 @@
 
 #pragma once
 
+#include "NodeAllocator.h" // Used for HeapAllocator, the default node allocator.
+
 /*
 	DESCRIPTION: A Queue of nodes that supports forward traversal only.
 */
-template<typename Type>
+template<typename Type, template<typename> class Allocator = HeapAllocator>
 class Queue
 {
 public:
@@ -24,7 +26,7 @@ public:
 	*/
 	class Node
 	{
-		friend typename Queue<Type>;
+		friend typename Queue<Type, Allocator>;
 
 	private:
 		// DATA MEMBERS
@@ -61,6 +63,25 @@ private:
 	Node* m_head; // The head of the queue.
 	Node* m_tail; // The tail of the queue.
 	unsigned int m_size; // The number of items in the queue.
+	Allocator<Node> m_allocator; // Provides the memory for each node.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates a node with the allocator and constructs it.
+		PARAMETERS:
+			const Type& _data, the item the node houses.
+			Node* _next, the node after the new node.
+		RETURNS: (Node*) The new node.
+	*/
+	inline Node* CreateNode(const Type& _data, Node* _next);
+
+	/*
+		DESCRIPTION: Destroys a node and returns its memory to the allocator.
+		PARAMETERS:
+			Node* _node, the node to destroy.
+	*/
+	inline void DestroyNode(Node* _node);
 
 public:
 	// FUNCTIONS
@@ -73,9 +94,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided queue.
 		PARAMETERS:
-			const Queue<Type>& _queue, the queue to copy.
+			const Queue<Type, Allocator>& _queue, the queue to copy.
 	*/
-	Queue(const Queue<Type>& _queue);
+	Queue(const Queue<Type, Allocator>& _queue);
 
 	/*
 		DESCRIPTION: Deallocates the queue.
@@ -85,9 +106,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided queue.
 		PARAMETERS:
-			const Queue<Type>& _queue, the queue to copy.
+			const Queue<Type, Allocator>& _queue, the queue to copy.
 	*/
-	Queue<Type>& operator=(const Queue<Type>& _queue);
+	Queue<Type, Allocator>& operator=(const Queue<Type, Allocator>& _queue);
 
 	/*
 		DESCRIPTION: Adds an item to the tail of the queue.
@@ -128,25 +149,28 @@ public:
 	inline Node* Peek();
 };
 
-template<typename T>
-Queue<T>::Queue()
+template<typename Type, template<typename> class Allocator>
+Queue<Type, Allocator>::Queue()
 {
 	m_head = m_tail = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-Queue<Type>::Queue(const Queue<Type>& _queue)
+template<typename Type, template<typename> class Allocator>
+Queue<Type, Allocator>::Queue(const Queue<Type, Allocator>& _queue) :
+	m_head(nullptr),
+	m_tail(nullptr),
+	m_size(0)
 {
 	Node* iter = _queue.m_head;
 
 	if (iter)
 	{
-		m_head = m_tail = new Node(iter->m_data, nullptr);
+		m_head = m_tail = CreateNode(iter->m_data, nullptr);
 
-		while (iter = iter->m_next)
+		while ((iter = iter->m_next))
 		{
-			m_tail->m_next = new Node(iter->m_data, nullptr);
+			m_tail->m_next = CreateNode(iter->m_data, nullptr);
 			m_tail = m_tail->m_next;
 		}
 
@@ -154,14 +178,14 @@ Queue<Type>::Queue(const Queue<Type>& _queue)
 	}
 }
 
-template<typename T>
-Queue<T>::~Queue()
+template<typename Type, template<typename> class Allocator>
+Queue<Type, Allocator>::~Queue()
 {
 	Clear();
 }
 
-template<typename Type>
-Queue<Type>& Queue<Type>::operator=(const Queue<Type>& _queue)
+template<typename Type, template<typename> class Allocator>
+Queue<Type, Allocator>& Queue<Type, Allocator>::operator=(const Queue<Type, Allocator>& _queue)
 {
 	// We don't need to do anything if we are assigning to ourself.
 	if (this == &_queue)
@@ -174,11 +198,11 @@ Queue<Type>& Queue<Type>::operator=(const Queue<Type>& _queue)
 
 	if (iter)
 	{
-		m_head = m_tail = new Node(iter->m_data, nullptr);
+		m_head = m_tail = CreateNode(iter->m_data, nullptr);
 
-		while (iter = iter->m_next)
+		while ((iter = iter->m_next))
 		{
-			m_tail->m_next = new Node(iter->m_data, nullptr);
+			m_tail->m_next = CreateNode(iter->m_data, nullptr);
 			m_tail = m_tail->m_next;
 		}
 
@@ -188,22 +212,22 @@ Queue<Type>& Queue<Type>::operator=(const Queue<Type>& _queue)
 	return *this;
 }
 
-template<typename Type>
-void Queue<Type>::Enqueue(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void Queue<Type, Allocator>::Enqueue(const Type& _data)
 {
 	if (m_tail)
 	{
-		m_tail->m_next = new Node(_data, nullptr);
+		m_tail->m_next = CreateNode(_data, nullptr);
 		m_tail = m_tail->m_next;
 	}
 	else
-		m_head = m_tail = new Node(_data, nullptr);
+		m_head = m_tail = CreateNode(_data, nullptr);
 
 	++m_size;
 }
 
-template<typename Type>
-bool Queue<Type>::Dequeue()
+template<typename Type, template<typename> class Allocator>
+bool Queue<Type, Allocator>::Dequeue()
 {
 	if (!m_head)
 		return false;
@@ -214,14 +238,14 @@ bool Queue<Type>::Dequeue()
 	if (!m_head)
 		m_tail = nullptr;
 
-	delete delNode;
+	DestroyNode(delNode);
 	--m_size;
 
 	return true;
 }
 
-template<typename Type>
-bool Queue<Type>::Find(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+bool Queue<Type, Allocator>::Find(const Type& _data)
 {
 	for (Node* iter = m_head; iter; iter = iter->m_next)
 		if (iter->m_data == _data)
@@ -230,8 +254,8 @@ bool Queue<Type>::Find(const Type& _data)
 	return false;
 }
 
-template<typename Type>
-void Queue<Type>::Clear()
+template<typename Type, template<typename> class Allocator>
+void Queue<Type, Allocator>::Clear()
 {
 	Node* iter;
 
@@ -239,21 +263,34 @@ void Queue<Type>::Clear()
 	{
 		iter = m_head;
 		m_head = m_head->m_next;
-		delete iter;
+		DestroyNode(iter);
 	}
 
 	m_head = m_tail = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-inline unsigned int Queue<Type>::Size() const
+template<typename Type, template<typename> class Allocator>
+inline unsigned int Queue<Type, Allocator>::Size() const
 {
 	return m_size;
 }
 
-template<typename Type>
-typename Queue<Type>::Node* Queue<Type>::Peek()
+template<typename Type, template<typename> class Allocator>
+typename Queue<Type, Allocator>::Node* Queue<Type, Allocator>::Peek()
 {
 	return m_head;
 }
+
+template<typename Type, template<typename> class Allocator>
+typename Queue<Type, Allocator>::Node* Queue<Type, Allocator>::CreateNode(const Type& _data, Node* _next)
+{
+	return new (m_allocator.Allocate()) Node(_data, _next);
+}
+
+template<typename Type, template<typename> class Allocator>
+void Queue<Type, Allocator>::DestroyNode(Node* _node)
+{
+	_node->~Node();
+	m_allocator.Deallocate(_node);
+}
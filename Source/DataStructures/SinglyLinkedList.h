@@ -2,7 +2,7 @@
 	FILE: SinglyLinkedList.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 23, 2021
-	MODIFIED: January 29, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: A templated Singly-Linked List data structure. The benefits of this Linked List are:
 		- AddHead(): On average O(1), worst case O(1).
 		- AddTail(): On average O(1), worst case O(1).
@@ -17,10 +17,12 @@
 
 #pragma once
 
+#include "NodeAllocator.h" // Used for HeapAllocator, the default node allocator.
+
 /*
 	DESCRIPTION: A Linked List of nodes that supports forward traversal only.
 */
-template<typename Type> 
+template<typename Type, template<typename> class Allocator = HeapAllocator>
 class SinglyLinkedList
 {
 public:
@@ -29,7 +31,7 @@ public:
 	*/
 	class Node
 	{
-		friend typename SinglyLinkedList<Type>;
+		friend typename SinglyLinkedList<Type, Allocator>;
 
 	private:
 		// DATA MEMBERS
@@ -66,6 +68,25 @@ private:
 	Node* m_head; // The head of the list.
 	Node* m_tail; // The tail of the list.
 	unsigned int m_size; // The number of items in the list.
+	Allocator<Node> m_allocator; // Provides the memory for each node.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates a node with the allocator and constructs it.
+		PARAMETERS:
+			const Type& _data, the item the node houses.
+			Node* _next, the node after the new node.
+		RETURNS: (Node*) The new node.
+	*/
+	inline Node* CreateNode(const Type& _data, Node* _next);
+
+	/*
+		DESCRIPTION: Destroys a node and returns its memory to the allocator.
+		PARAMETERS:
+			Node* _node, the node to destroy.
+	*/
+	inline void DestroyNode(Node* _node);
 
 public:
 	// FUNCTIONS
@@ -78,9 +99,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided list.
 		PARAMETERS:
-			const SinglyLinkedList<Type>& _list, the list to copy.
+			const SinglyLinkedList<Type, Allocator>& _list, the list to copy.
 	*/
-	SinglyLinkedList(const SinglyLinkedList<Type>& _list);
+	SinglyLinkedList(const SinglyLinkedList<Type, Allocator>& _list);
 
 	/*
 		DESCRIPTION: Deallocates the list.
@@ -90,9 +111,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided list.
 		PARAMETERS:
-			const SinglyLinkedList<Type>& _list, the list to copy.
+			const SinglyLinkedList<Type, Allocator>& _list, the list to copy.
 	*/
-	SinglyLinkedList<Type>& operator=(const SinglyLinkedList<Type>& _list);
+	SinglyLinkedList<Type, Allocator>& operator=(const SinglyLinkedList<Type, Allocator>& _list);
 
 	/*
 		DESCRIPTION: Adds an item to the head of the list.
@@ -168,15 +189,18 @@ public:
 	inline Node* PeekTail();
 };
 
-template<typename T>
-SinglyLinkedList<T>::SinglyLinkedList()
+template<typename Type, template<typename> class Allocator>
+SinglyLinkedList<Type, Allocator>::SinglyLinkedList()
 {
 	m_head = m_tail = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-SinglyLinkedList<Type>::SinglyLinkedList(const SinglyLinkedList<Type>& _list)
+template<typename Type, template<typename> class Allocator>
+SinglyLinkedList<Type, Allocator>::SinglyLinkedList(const SinglyLinkedList<Type, Allocator>& _list) :
+	m_head(nullptr),
+	m_tail(nullptr),
+	m_size(0)
 {
 	Node* iter = _list.m_head;
 
@@ -185,18 +209,18 @@ SinglyLinkedList<Type>::SinglyLinkedList(const SinglyLinkedList<Type>& _list)
 		do
 		{
 			AddTail(iter->m_data);
-		} while (iter = iter->m_next);
+		} while ((iter = iter->m_next));
 	}
 }
 
-template<typename T>
-SinglyLinkedList<T>::~SinglyLinkedList()
+template<typename Type, template<typename> class Allocator>
+SinglyLinkedList<Type, Allocator>::~SinglyLinkedList()
 {
 	Clear();
 }
 
-template<typename Type>
-SinglyLinkedList<Type>& SinglyLinkedList<Type>::operator=(const SinglyLinkedList<Type>& _list)
+template<typename Type, template<typename> class Allocator>
+SinglyLinkedList<Type, Allocator>& SinglyLinkedList<Type, Allocator>::operator=(const SinglyLinkedList<Type, Allocator>& _list)
 {
 	// We don't need to do anything if we are assigning to ourself.
 	if (this == &_list)
@@ -212,39 +236,39 @@ SinglyLinkedList<Type>& SinglyLinkedList<Type>::operator=(const SinglyLinkedList
 		do
 		{
 			AddTail(iter->m_data);
-		} while (iter = iter->m_next);
+		} while ((iter = iter->m_next));
 	}
 
 	return *this;
 }
 
-template<typename Type>
-void SinglyLinkedList<Type>::AddHead(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void SinglyLinkedList<Type, Allocator>::AddHead(const Type& _data)
 {
 	if (m_head)
-		m_head = new Node(_data, m_head);
+		m_head = CreateNode(_data, m_head);
 	else
-		m_head = m_tail = new Node(_data, nullptr);
+		m_head = m_tail = CreateNode(_data, nullptr);
 
 	++m_size;
 }
 
-template<typename Type>
-void SinglyLinkedList<Type>::AddTail(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void SinglyLinkedList<Type, Allocator>::AddTail(const Type& _data)
 {
 	if (m_tail)
 	{
-		m_tail->m_next = new Node(_data, nullptr);
+		m_tail->m_next = CreateNode(_data, nullptr);
 		m_tail = m_tail->m_next;
 	}
 	else
-		m_head = m_tail = new Node(_data, nullptr);
+		m_head = m_tail = CreateNode(_data, nullptr);
 
 	++m_size;
 }
 
-template<typename Type>
-void SinglyLinkedList<Type>::Insert(Node* _node, const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void SinglyLinkedList<Type, Allocator>::Insert(Node* _node, const Type& _data)
 {
 	if (_node == m_head)
 		AddHead(_data);
@@ -253,13 +277,13 @@ void SinglyLinkedList<Type>::Insert(Node* _node, const Type& _data)
 		Node* iter;
 		for (iter = m_head; iter->m_next != _node; iter = iter->m_next) {}
 
-		iter->m_next = new Node(_data, iter->m_next);
+		iter->m_next = CreateNode(_data, iter->m_next);
 		++m_size;
 	}
 }
 
-template<typename Type>
-bool SinglyLinkedList<Type>::Remove(Node* _node)
+template<typename Type, template<typename> class Allocator>
+bool SinglyLinkedList<Type, Allocator>::Remove(Node* _node)
 {
 	if (!_node)
 		return false;
@@ -275,15 +299,15 @@ bool SinglyLinkedList<Type>::Remove(Node* _node)
 
 		iter->m_next = _node->m_next;
 
-		delete _node;
+		DestroyNode(_node);
 		--m_size;
 	}
 
 	return true;
 }
 
-template<typename Type>
-bool SinglyLinkedList<Type>::RemoveHead()
+template<typename Type, template<typename> class Allocator>
+bool SinglyLinkedList<Type, Allocator>::RemoveHead()
 {
 	if (!m_head)
 		return false;
@@ -294,14 +318,14 @@ bool SinglyLinkedList<Type>::RemoveHead()
 	if (!m_head)
 		m_tail = nullptr;
 
-	delete delNode;
+	DestroyNode(delNode);
 	--m_size;
 
 	return true;
 }
 
-template<typename Type>
-bool SinglyLinkedList<Type>::RemoveTail()
+template<typename Type, template<typename> class Allocator>
+bool SinglyLinkedList<Type, Allocator>::RemoveTail()
 {
 	if (!m_tail)
 		return false;
@@ -319,14 +343,14 @@ bool SinglyLinkedList<Type>::RemoveTail()
 		m_tail->m_next = nullptr;
 	}
 
-	delete delNode;
+	DestroyNode(delNode);
 	--m_size;
 
 	return true;
 }
 
-template<typename Type>
-bool SinglyLinkedList<Type>::Find(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+bool SinglyLinkedList<Type, Allocator>::Find(const Type& _data)
 {
 	for (Node* iter = m_head; iter; iter = iter->m_next)
 		if (iter->m_data == _data)
@@ -335,8 +359,8 @@ bool SinglyLinkedList<Type>::Find(const Type& _data)
 	return false;
 }
 
-template<typename Type>
-void SinglyLinkedList<Type>::Clear()
+template<typename Type, template<typename> class Allocator>
+void SinglyLinkedList<Type, Allocator>::Clear()
 {
 	Node* iter;
 
@@ -344,27 +368,40 @@ void SinglyLinkedList<Type>::Clear()
 	{
 		iter = m_head;
 		m_head = m_head->m_next;
-		delete iter;
+		DestroyNode(iter);
 	}
 
 	m_head = m_tail = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-inline unsigned int SinglyLinkedList<Type>::Size() const
+template<typename Type, template<typename> class Allocator>
+inline unsigned int SinglyLinkedList<Type, Allocator>::Size() const
 {
 	return m_size;
 }
 
-template<typename Type>
-typename SinglyLinkedList<Type>::Node* SinglyLinkedList<Type>::PeekHead()
+template<typename Type, template<typename> class Allocator>
+typename SinglyLinkedList<Type, Allocator>::Node* SinglyLinkedList<Type, Allocator>::PeekHead()
 {
 	return m_head;
 }
 
-template<typename Type>
-typename SinglyLinkedList<Type>::Node* SinglyLinkedList<Type>::PeekTail()
+template<typename Type, template<typename> class Allocator>
+typename SinglyLinkedList<Type, Allocator>::Node* SinglyLinkedList<Type, Allocator>::PeekTail()
 {
 	return m_tail;
 }
+
+template<typename Type, template<typename> class Allocator>
+typename SinglyLinkedList<Type, Allocator>::Node* SinglyLinkedList<Type, Allocator>::CreateNode(const Type& _data, Node* _next)
+{
+	return new (m_allocator.Allocate()) Node(_data, _next);
+}
+
+template<typename Type, template<typename> class Allocator>
+void SinglyLinkedList<Type, Allocator>::DestroyNode(Node* _node)
+{
+	_node->~Node();
+	m_allocator.Deallocate(_node);
+}
@@ -0,0 +1,354 @@
+/*
+	FILE: Snapshot.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Reads and writes snapshot files, which the sorted data structures use to save their items and load
+		them back without comparing or rebalancing. A snapshot holds a header, which records the item size and the
+		number of items, followed by the items as raw memory in sorted order. Only trivially copyable types can be
+		saved, and the bytes are in the byte order of the machine that wrote them. The classes are:
+		- SnapshotWriter: Writes a header and then the items one at a time. Items are gathered in a buffer and written
+			in large blocks.
+		- SnapshotReader: Provides the items of a snapshot. On Unix-like systems the file is memory mapped, so the
+			items are read in place without copying them. Other systems read the file into memory.
+*/
+
+#pragma once
+
+#include <cstdint> // Used for the fixed size integer types in the file header.
+#include <cstdio> // Used for std::fopen, std::fwrite, std::fread, and std::fclose.
+#include <cstring> // Used for std::memcpy and std::memset.
+#include <new> // Used for ::operator new and ::operator delete.
+
+#if defined(__unix__) || defined(__APPLE__)
+	#define SNAPSHOT_MAPPED
+
+	#include <fcntl.h> // Used for open.
+	#include <sys/mman.h> // Used for mmap, madvise, and munmap.
+	#include <sys/stat.h> // Used for fstat.
+	#include <unistd.h> // Used for close.
+#endif
+
+/*
+	DESCRIPTION: The start of a snapshot file. The items start right after the header, 64 bytes into the file.
+*/
+struct SnapshotHeader
+{
+	static constexpr uint64_t MAGIC = 0x544F485350414E53ull; // "SNAPSHOT" in little endian bytes.
+
+	uint64_t magic; // Identifies the file as a snapshot.
+	uint32_t itemSize; // The size of each item, so that a file isn't loaded as items of a different type.
+	uint32_t count; // Number of items in the file.
+	unsigned char reserved[48]; // Pads the header to 64 bytes, so that the items are aligned to a cache line.
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "The snapshot header must be 64 bytes.");
+
+/*
+	DESCRIPTION: Writes the items of a data structure to a snapshot file.
+*/
+class SnapshotWriter
+{
+private:
+	// DATA MEMBERS
+
+	static constexpr unsigned int BUFFER_SIZE = 64 * 1024; // The number of bytes gathered before writing them.
+
+	std::FILE* m_file; // The file being written, or nullptr if it could not be opened.
+	bool m_failed; // True once a write has failed.
+	unsigned int m_bufferSize; // The number of bytes in the buffer.
+	unsigned char m_buffer[BUFFER_SIZE]; // Items that have not been written yet.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Writes the bytes in the buffer to the file and empties the buffer.
+	*/
+	inline void Flush();
+
+public:
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Creates or replaces a file and writes the header.
+		PARAMETERS:
+			const char* _path, the path of the file to write.
+			unsigned int _itemSize, the size of each item in bytes.
+			unsigned int _count, the number of items that will be written.
+	*/
+	inline SnapshotWriter(const char* _path, unsigned int _itemSize, unsigned int _count);
+
+	SnapshotWriter(const SnapshotWriter& _writer) = delete;
+	SnapshotWriter& operator=(const SnapshotWriter& _writer) = delete;
+
+	/*
+		DESCRIPTION: Closes the file if Close() was not called.
+	*/
+	inline ~SnapshotWriter();
+
+	/*
+		DESCRIPTION: Writes the next item. Writes are buffered, so a failure may not be known until Close().
+			Writing each item by itself costs a call into the C library, which locks the file every time.
+		PARAMETERS:
+			const void* _item, the item to write.
+			unsigned int _itemSize, the size of the item in bytes.
+	*/
+	inline void Write(const void* _item, unsigned int _itemSize);
+
+	/*
+		DESCRIPTION: Writes any buffered items and closes the file.
+		RETURNS: bool - If the header and all of the items were written.
+	*/
+	inline bool Close();
+};
+
+/*
+	DESCRIPTION: Provides the items of a snapshot file.
+*/
+class SnapshotReader
+{
+private:
+	// DATA MEMBERS
+
+	void* m_memory; // The mapping of the whole file, or the memory it was read into.
+	size_t m_memorySize; // The size of m_memory in bytes.
+	const unsigned char* m_items; // The items, just after the header.
+	unsigned int m_count; // Number of items in the file.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Maps or reads a whole file into memory.
+		PARAMETERS:
+			const char* _path, the path of the file to read.
+		RETURNS: bool - If the file was mapped or read.
+	*/
+	inline bool Load(const char* _path);
+
+	/*
+		DESCRIPTION: Unmaps or frees the memory of the file.
+	*/
+	inline void Unload();
+
+public:
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Opens a snapshot file. IsOpen() tells if the file was opened.
+		PARAMETERS:
+			const char* _path, the path of the file to read.
+			unsigned int _itemSize, the size of each item in bytes. A file of items of a different size is not opened.
+	*/
+	inline SnapshotReader(const char* _path, unsigned int _itemSize);
+
+	SnapshotReader(const SnapshotReader& _reader) = delete;
+	SnapshotReader& operator=(const SnapshotReader& _reader) = delete;
+
+	/*
+		DESCRIPTION: Closes the file. The items can no longer be used.
+	*/
+	inline ~SnapshotReader();
+
+	/*
+		DESCRIPTION: Returns if the file is open.
+		RETURNS: bool - If the file was opened and holds a snapshot of items of the given size.
+	*/
+	inline bool IsOpen() const;
+
+	/*
+		DESCRIPTION: Provides the items in the file. They are valid until the reader is destroyed.
+		RETURNS: const void* - The first item, aligned for any type that is not over-aligned.
+	*/
+	inline const void* Items() const;
+
+	/*
+		DESCRIPTION: Provides the number of items in the file.
+		RETURNS: unsigned int - The number of items.
+	*/
+	inline unsigned int Count() const;
+};
+
+SnapshotWriter::SnapshotWriter(const char* _path, unsigned int _itemSize, unsigned int _count) :
+	m_file(std::fopen(_path, "wb")),
+	m_failed(false),
+	m_bufferSize(0)
+{
+	SnapshotHeader header;
+	std::memset(&header, 0, sizeof(header));
+
+	header.magic = SnapshotHeader::MAGIC;
+	header.itemSize = _itemSize;
+	header.count = _count;
+
+	Write(&header, sizeof(header));
+}
+
+SnapshotWriter::~SnapshotWriter()
+{
+	Close();
+}
+
+void SnapshotWriter::Write(const void* _item, unsigned int _itemSize)
+{
+	if (!m_file || m_failed)
+		return;
+
+	if (m_bufferSize + _itemSize > BUFFER_SIZE)
+		Flush();
+
+	// An item too large for the buffer is written by itself.
+	if (_itemSize > BUFFER_SIZE)
+	{
+		if (std::fwrite(_item, _itemSize, 1, m_file) != 1)
+			m_failed = true;
+
+		return;
+	}
+
+	std::memcpy(m_buffer + m_bufferSize, _item, _itemSize);
+	m_bufferSize += _itemSize;
+}
+
+void SnapshotWriter::Flush()
+{
+	if (m_bufferSize > 0 && std::fwrite(m_buffer, m_bufferSize, 1, m_file) != 1)
+		m_failed = true;
+
+	m_bufferSize = 0;
+}
+
+bool SnapshotWriter::Close()
+{
+	if (!m_file)
+		return false;
+
+	if (!m_failed)
+		Flush();
+
+	if (std::fclose(m_file) != 0)
+		m_failed = true;
+
+	m_file = nullptr;
+
+	return !m_failed;
+}
+
+SnapshotReader::SnapshotReader(const char* _path, unsigned int _itemSize) :
+	m_memory(nullptr),
+	m_memorySize(0),
+	m_items(nullptr),
+	m_count(0)
+{
+	if (!Load(_path))
+		return;
+
+	// The file must hold a header of this item size, followed by exactly the number of items it records.
+	const SnapshotHeader* header = static_cast<const SnapshotHeader*>(m_memory);
+
+	if (m_memorySize < sizeof(SnapshotHeader) || header->magic != SnapshotHeader::MAGIC ||
+		header->itemSize != _itemSize || m_memorySize - sizeof(SnapshotHeader) != static_cast<size_t>(header->count) * _itemSize)
+	{
+		Unload();
+		return;
+	}
+
+	m_items = static_cast<const unsigned char*>(m_memory) + sizeof(SnapshotHeader);
+	m_count = header->count;
+}
+
+SnapshotReader::~SnapshotReader()
+{
+	Unload();
+}
+
+bool SnapshotReader::Load(const char* _path)
+{
+#if defined(SNAPSHOT_MAPPED)
+	int file = open(_path, O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(file, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SnapshotHeader))
+	{
+		close(file);
+		return false;
+	}
+
+	void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+	// The mapping keeps the file open, so the descriptor isn't needed anymore.
+	close(file);
+
+	if (mapping == MAP_FAILED)
+		return false;
+
+	// Only a hint, which lets the system read ahead since the items are visited in order.
+#if defined(MADV_SEQUENTIAL)
+	madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+#endif
+
+	m_memory = mapping;
+	m_memorySize = info.st_size;
+#else
+	std::FILE* file = std::fopen(_path, "rb");
+	if (!file)
+		return false;
+
+	long size = -1;
+	if (std::fseek(file, 0, SEEK_END) == 0)
+		size = std::ftell(file);
+
+	if (size < static_cast<long>(sizeof(SnapshotHeader)) || std::fseek(file, 0, SEEK_SET) != 0)
+	{
+		std::fclose(file);
+		return false;
+	}
+
+	m_memory = ::operator new(size);
+	m_memorySize = size;
+
+	const bool isRead = std::fread(m_memory, 1, m_memorySize, file) == m_memorySize;
+	std::fclose(file);
+
+	if (!isRead)
+	{
+		Unload();
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+void SnapshotReader::Unload()
+{
+	if (m_memory)
+	{
+#if defined(SNAPSHOT_MAPPED)
+		munmap(m_memory, m_memorySize);
+#else
+		::operator delete(m_memory);
+#endif
+	}
+
+	m_memory = nullptr;
+	m_memorySize = 0;
+	m_items = nullptr;
+	m_count = 0;
+}
+
+bool SnapshotReader::IsOpen() const
+{
+	return m_items != nullptr;
+}
+
+const void* SnapshotReader::Items() const
+{
+	return m_items;
+}
+
+unsigned int SnapshotReader::Count() const
+{
+	return m_count;
+}
@@ -2,7 +2,7 @@
 	FILE: Stack.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 31, 2021
-	MODIFIED: January 31, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: A templated Stack data structure. The benefits of this Stack are:
 		- Push(): On average O(1), worst case O(1).
 		- Pop(): On average O(1), worst case O(1).
@@ -12,10 +12,12 @@
 
 #pragma once
 
+#include "NodeAllocator.h" // Used for HeapAllocator, the default node allocator.
+
 /*
 	DESCRIPTION: A Stack of nodes that supports forward traversal only.
 */
-template<typename Type>
+template<typename Type, template<typename> class Allocator = HeapAllocator>
 class Stack
 {
 public:
@@ -24,7 +26,7 @@ public:
 	*/
 	class Node
 	{
-		friend typename Stack<Type>;
+		friend typename Stack<Type, Allocator>;
 
 	private:
 		// DATA MEMBERS
@@ -60,6 +62,25 @@ private:
 
 	Node* m_head; // The head of the stack.
 	unsigned int m_size; // The number of items in the stack.
+	Allocator<Node> m_allocator; // Provides the memory for each node.
+
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Allocates a node with the allocator and constructs it.
+		PARAMETERS:
+			const Type& _data, the item the node houses.
+			Node* _next, the node after the new node.
+		RETURNS: (Node*) The new node.
+	*/
+	inline Node* CreateNode(const Type& _data, Node* _next);
+
+	/*
+		DESCRIPTION: Destroys a node and returns its memory to the allocator.
+		PARAMETERS:
+			Node* _node, the node to destroy.
+	*/
+	inline void DestroyNode(Node* _node);
 
 public:
 	// FUNCTIONS
@@ -72,9 +93,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided stack.
 		PARAMETERS:
-			const Stack<Type>& _stack, the stack to copy.
+			const Stack<Type, Allocator>& _stack, the stack to copy.
 	*/
-	Stack(const Stack<Type>& _stack);
+	Stack(const Stack<Type, Allocator>& _stack);
 
 	/*
 		DESCRIPTION: Deallocates the stack.
@@ -84,9 +105,9 @@ public:
 	/*
 		DESCRIPTION: Deep copies the provided stack.
 		PARAMETERS:
-			const Stack<Type>& _stack, the stack to copy.
+			const Stack<Type, Allocator>& _stack, the stack to copy.
 	*/
-	Stack<Type>& operator=(const Stack<Type>& _stack);
+	Stack<Type, Allocator>& operator=(const Stack<Type, Allocator>& _stack);
 
 	/*
 		DESCRIPTION: Adds an item to the head of the stack.
@@ -127,25 +148,27 @@ public:
 	inline Node* Peek();
 };
 
-template<typename T>
-Stack<T>::Stack()
+template<typename Type, template<typename> class Allocator>
+Stack<Type, Allocator>::Stack()
 {
 	m_head = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-Stack<Type>::Stack(const Stack<Type>& _stack)
+template<typename Type, template<typename> class Allocator>
+Stack<Type, Allocator>::Stack(const Stack<Type, Allocator>& _stack) :
+	m_head(nullptr),
+	m_size(0)
 {
 	Node* iter = _stack.m_head;
 
 	if (iter)
 	{
-		Node* tail = m_head = new Node(iter->m_data, nullptr);
+		Node* tail = m_head = CreateNode(iter->m_data, nullptr);
 
-		while (iter = iter->m_next)
+		while ((iter = iter->m_next))
 		{
-			tail->m_next = new Node(iter->m_data, nullptr);
+			tail->m_next = CreateNode(iter->m_data, nullptr);
 			tail = tail->m_next;
 		}
 		
@@ -153,14 +176,14 @@ Stack<Type>::Stack(const Stack<Type>& _stack)
 	}
 }
 
-template<typename T>
-Stack<T>::~Stack()
+template<typename Type, template<typename> class Allocator>
+Stack<Type, Allocator>::~Stack()
 {
 	Clear();
 }
 
-template<typename Type>
-Stack<Type>& Stack<Type>::operator=(const Stack<Type>& _stack)
+template<typename Type, template<typename> class Allocator>
+Stack<Type, Allocator>& Stack<Type, Allocator>::operator=(const Stack<Type, Allocator>& _stack)
 {
 	// We don't need to do anything if we are assigning to ourself.
 	if (this == &_stack)
@@ -173,11 +196,11 @@ Stack<Type>& Stack<Type>::operator=(const Stack<Type>& _stack)
 
 	if (iter)
 	{
-		Node* tail = m_head = new Node(iter->m_data, nullptr);
+		Node* tail = m_head = CreateNode(iter->m_data, nullptr);
 
-		while (iter = iter->m_next)
+		while ((iter = iter->m_next))
 		{
-			tail->m_next = new Node(iter->m_data, nullptr);
+			tail->m_next = CreateNode(iter->m_data, nullptr);
 			tail = tail->m_next;
 		}
 
@@ -187,15 +210,15 @@ Stack<Type>& Stack<Type>::operator=(const Stack<Type>& _stack)
 	return *this;
 }
 
-template<typename Type>
-void Stack<Type>::Push(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+void Stack<Type, Allocator>::Push(const Type& _data)
 {
-	m_head = new Node(_data, m_head);
+	m_head = CreateNode(_data, m_head);
 	++m_size;
 }
 
-template<typename Type>
-bool Stack<Type>::Pop()
+template<typename Type, template<typename> class Allocator>
+bool Stack<Type, Allocator>::Pop()
 {
 	if (!m_head)
 		return false;
@@ -203,14 +226,14 @@ bool Stack<Type>::Pop()
 	Node* delNode = m_head;
 	m_head = m_head->m_next;
 
-	delete delNode;
+	DestroyNode(delNode);
 	--m_size;
 
 	return true;
 }
 
-template<typename Type>
-bool Stack<Type>::Find(const Type& _data)
+template<typename Type, template<typename> class Allocator>
+bool Stack<Type, Allocator>::Find(const Type& _data)
 {
 	for (Node* iter = m_head; iter; iter = iter->m_next)
 		if (iter->m_data == _data)
@@ -219,8 +242,8 @@ bool Stack<Type>::Find(const Type& _data)
 	return false;
 }
 
-template<typename Type>
-void Stack<Type>::Clear()
+template<typename Type, template<typename> class Allocator>
+void Stack<Type, Allocator>::Clear()
 {
 	Node* iter;
 
@@ -228,21 +251,34 @@ void Stack<Type>::Clear()
 	{
 		iter = m_head;
 		m_head = m_head->m_next;
-		delete iter;
+		DestroyNode(iter);
 	}
 
 	m_head = nullptr;
 	m_size = 0;
 }
 
-template<typename Type>
-inline unsigned int Stack<Type>::Size() const
+template<typename Type, template<typename> class Allocator>
+inline unsigned int Stack<Type, Allocator>::Size() const
 {
 	return m_size;
 }
 
-template<typename Type>
-typename Stack<Type>::Node* Stack<Type>::Peek()
+template<typename Type, template<typename> class Allocator>
+typename Stack<Type, Allocator>::Node* Stack<Type, Allocator>::Peek()
 {
 	return m_head;
 }
+
+template<typename Type, template<typename> class Allocator>
+typename Stack<Type, Allocator>::Node* Stack<Type, Allocator>::CreateNode(const Type& _data, Node* _next)
+{
+	return new (m_allocator.Allocate()) Node(_data, _next);
+}
+
+template<typename Type, template<typename> class Allocator>
+void Stack<Type, Allocator>::DestroyNode(Node* _node)
+{
+	_node->~Node();
+	m_allocator.Deallocate(_node);
+}
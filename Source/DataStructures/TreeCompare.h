@@ -0,0 +1,64 @@
+/*
+	FILE: TreeCompare.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: The default comparison function for the trees. It orders values with operator<, unless the tree
+		was constructed from a "lesser" std::function, in which case that function orders them instead.
+*/
+
+#pragma once
+
+#include <functional> // Used for std::function.
+
+/*
+	DESCRIPTION: A "lesser" comparison function that uses operator<, or a stored std::function when one is given.
+*/
+template<typename Type>
+class LesserCompare
+{
+private:
+	// DATA MEMBERS
+
+	std::function<bool(const Type&, const Type&)> m_isLesser; // The function for determining lesser values. Empty to use operator<.
+
+public:
+	// FUNCTIONS
+
+	/*
+		DESCRIPTION: Constructs a comparison function that uses operator<.
+	*/
+	LesserCompare() = default;
+
+	/*
+		DESCRIPTION: Constructs a comparison function that uses a "lesser" function.
+		PARAMETERS:
+			const std::function<bool(const Type&, const Type&)>& _isLesser, function for determining lesser values.
+	*/
+	explicit LesserCompare(const std::function<bool(const Type&, const Type&)>& _isLesser);
+
+	/*
+		DESCRIPTION: Determines if an item is lesser than another item.
+		PARAMETERS:
+			const Type& _lhs, the item on the left of the comparison.
+			const Type& _rhs, the item on the right of the comparison.
+		RETURNS: (bool) true, if _lhs is lesser than _rhs.
+	*/
+	inline bool operator()(const Type& _lhs, const Type& _rhs) const;
+};
+
+template<typename Type>
+LesserCompare<Type>::LesserCompare(const std::function<bool(const Type&, const Type&)>& _isLesser) :
+	m_isLesser(_isLesser)
+{
+}
+
+template<typename Type>
+bool LesserCompare<Type>::operator()(const Type& _lhs, const Type& _rhs) const
+{
+	// Trees built without a function take this branch every time, so it is predicted and operator< is inlined.
+	if (m_isLesser)
+		return m_isLesser(_lhs, _rhs);
+
+	return _lhs < _rhs;
+}
@@ -2,13 +2,17 @@
 	FILE: AVLTreeTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 26, 2021
-	MODIFIED: January 27, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the interface of the AVL Tree and also demonstrates how the data	structure
 		can be used.
 */
 
 #pragma once
 
+#include <algorithm> // Used for std::find and std::find_if.
+#include <cstdio> // Used for std::remove.
+#include <iterator> // Used for std::distance, std::next, and std::prev.
+
 #include "../UnitTests/UnitTest.h"
 #include "../DataStructures/AVLTree.h"
 
@@ -136,6 +140,106 @@ namespace UT
 					}
 
 				Require(tree.Size() == NUM_COUNT)
+
+				// A copy should report the same number of items.
+				AVLTree<int> treeCopy(tree);
+				Require(treeCopy.Size() == NUM_COUNT)
+			}
+
+			Subtest("Size() is kept current")
+			{
+				AVLTree<int> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Insert the keys in a scrambled order. Multiplying by an odd number visits every key exactly once.
+				constexpr unsigned int BULK_COUNT = 1 << 16;
+				bool isSizeCorrect = true;
+
+				for (unsigned int i = 0; i < BULK_COUNT; ++i)
+				{
+					tree.Insert((i * 40503) % BULK_COUNT);
+					isSizeCorrect = isSizeCorrect && tree.Size() == i + 1;
+				}
+
+				Require(isSizeCorrect)
+
+				// Remove the even keys. Removing keys that aren't in the tree must not change the size.
+				for (unsigned int i = 0; i < BULK_COUNT; i += 2)
+				{
+					isSizeCorrect = isSizeCorrect && tree.Remove(i) && tree.Size() == BULK_COUNT - i / 2 - 1;
+					isSizeCorrect = isSizeCorrect && !tree.Remove(i) && !tree.Remove(BULK_COUNT + i);
+					isSizeCorrect = isSizeCorrect && tree.Size() == BULK_COUNT - i / 2 - 1;
+				}
+
+				Require(isSizeCorrect)
+				Require(tree.Size() == BULK_COUNT / 2)
+
+				// Call Size() 2^20 times on the large tree, inserting or removing an item before each call. Kept current, 
+				// this takes a few million steps. Counted by walking the tree, it would take 2^35 node visits, and the 
+				// tests would not finish.
+				constexpr unsigned int SIZE_CALL_COUNT = 1 << 20;
+				unsigned long long sizeTotal = 0;
+
+				for (unsigned int i = 0; i < SIZE_CALL_COUNT; ++i)
+				{
+					if (i % 2 == 0)
+						tree.Insert(BULK_COUNT);
+					else
+						tree.Remove(BULK_COUNT);
+
+					sizeTotal += tree.Size();
+				}
+
+				Require(sizeTotal == static_cast<unsigned long long>(SIZE_CALL_COUNT) * (BULK_COUNT / 2) + SIZE_CALL_COUNT / 2)
+
+				tree.Clear();
+				Require(tree.Size() == 0)
+
+				tree.Insert(1);
+				Require(tree.Size() == 1)
+			}
+
+			Subtest("Copy")
+			{
+				AVLTree<int> tree;
+
+				for (unsigned int i = 0; i < 1024; ++i)
+					tree.Insert((i * 389) % 1024);
+
+				// A copy has the same shape, so its height and preorder are the same.
+				AVLTree<int> treeCopy(tree);
+				AVLTree<int> treeAssigned;
+				treeAssigned.Insert(-16);
+				treeAssigned = tree;
+
+				int toArrayResult[1024] = { 0 };
+				int copyResult[1024] = { 0 };
+				int assignedResult[1024] = { 0 };
+				tree.ToArrayPreorder(toArrayResult);
+				treeCopy.ToArrayPreorder(copyResult);
+				treeAssigned.ToArrayPreorder(assignedResult);
+
+				Require(treeCopy.Height() == tree.Height())
+				Require(treeAssigned.Height() == tree.Height())
+
+				for (unsigned int i = 0; i < 1024; ++i)
+				{
+					Require(copyResult[i] == toArrayResult[i])
+					Require(assignedResult[i] == toArrayResult[i])
+				}
+
+				// The cached sizes are copied too.
+				for (unsigned int i = 0; i < 1024; ++i)
+				{
+					Require(treeCopy.Select(i) == static_cast<int>(i))
+					Require(treeCopy.Rank(i) == i)
+				}
+
+				// The copy is independent of the original.
+				Require(treeCopy.Remove(0))
+				Require(tree.Find(0))
 			}
 
 			Subtest("Height()")
@@ -147,7 +251,7 @@ namespace UT
 
 				Require(tree.Height() == 0)
 
-				const int expectedHeight[NUM_COUNT] = { 1, 2, 2, 3, 3, 4, 4, 4, 4, 5 };
+				const int expectedHeight[NUM_COUNT] = { 1, 2, 2, 3, 3, 3, 4, 4, 4, 4 };
 
 				// Fill the tree with numbers and test that the height increases as expected.
 				for (unsigned int i = 0; i < NUM_COUNT; ++i)
@@ -157,6 +261,169 @@ namespace UT
 				}
 			}
 
+			Subtest("Height() after bulk Insert() and Remove()")
+			{
+				AVLTree<int> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Sorted input is the worst case for an unbalanced tree. 2^16 - 1 keys fit exactly in 16 levels.
+				constexpr int BULK_COUNT = (1 << 16) - 1;
+
+				for (int i = 0; i < BULK_COUNT; ++i)
+					tree.Insert(i);
+
+				Require(tree.Size() == BULK_COUNT)
+				Require(tree.Height() == 16)
+
+				// Remove every other key. An AVL tree is never taller than 1.44 * log2(N + 2).
+				for (int i = 0; i < BULK_COUNT; i += 2)
+					Require(tree.Remove(i) == true)
+
+				Require(tree.Size() == BULK_COUNT / 2)
+				Require(tree.Height() <= 22)
+
+				for (int i = 0; i < BULK_COUNT; ++i)
+					Require(tree.Find(i) == (i % 2 != 0))
+			}
+
+			Subtest("Select()")
+			{
+				AVLTree<int> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Fill the tree with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				// The numbers are 0 to 9, so each number is its own position in sorted order.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(tree.Select(i) == static_cast<int>(i))
+
+				// Remove all even numbers and test that the positions shift.
+				for (unsigned int i = 0; i < NUM_COUNT; i += 2)
+					tree.Remove(i);
+
+				for (unsigned int i = 0; i < tree.Size(); ++i)
+					Require(tree.Select(i) == static_cast<int>(i * 2 + 1))
+			}
+
+			Subtest("Rank()")
+			{
+				AVLTree<int> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Try ranking when the tree is empty.
+				Require(tree.Rank(16) == 0)
+
+				// Fill the tree with even numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i] * 2);
+
+				// Test ranking numbers in and not in the tree.
+				for (unsigned int i = 0; i < NUM_COUNT * 2; ++i)
+					Require(tree.Rank(i) == (i + 1) / 2)
+
+				Require(tree.Rank(-1) == 0)
+				Require(tree.Rank(1024) == NUM_COUNT)
+			}
+
+			Subtest("CountInRange()")
+			{
+				AVLTree<int> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Fill the tree with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				Require(tree.CountInRange(0, NUM_COUNT) == NUM_COUNT)
+				Require(tree.CountInRange(3, 7) == 4)
+				Require(tree.CountInRange(-5, 2) == 2)
+				Require(tree.CountInRange(8, 1024) == 2)
+				Require(tree.CountInRange(5, 5) == 0)
+				Require(tree.CountInRange(7, 3) == 0)
+			}
+
+			Subtest("LowerBound(), UpperBound(), Floor(), and Ceiling()")
+			{
+				AVLTree<int> tree;
+
+				// Searching an empty tree finds nothing.
+				Require(tree.LowerBound(16) == tree.end())
+				Require(tree.Floor(16) == tree.end())
+
+				// Fill the tree with even numbers, with 4 inserted three times.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i] * 2);
+
+				tree.Insert(4);
+				tree.Insert(4);
+
+				// Items in the tree.
+				Require(*tree.LowerBound(6) == 6)
+				Require(*tree.UpperBound(6) == 8)
+				Require(*tree.Floor(6) == 6)
+				Require(*tree.Ceiling(6) == 6)
+
+				// Items between the items in the tree.
+				Require(*tree.LowerBound(7) == 8)
+				Require(*tree.UpperBound(7) == 8)
+				Require(*tree.Floor(7) == 6)
+				Require(*tree.Ceiling(7) == 8)
+
+				// Items past either end of the tree.
+				Require(tree.LowerBound(19) == tree.end())
+				Require(*tree.Floor(19) == 18)
+				Require(*tree.LowerBound(-1) == 0)
+				Require(tree.Floor(-1) == tree.end())
+
+				// Equal items are found between the bounds.
+				Require(std::distance(tree.LowerBound(4), tree.UpperBound(4)) == 3)
+				Require(tree.LowerBound(4) == std::next(tree.begin(), 2))
+				Require(*std::prev(tree.Floor(4), 3) == 2) // Floor() finds the last of the equal items.
+			}
+
+			Subtest("ForEachInRange()")
+			{
+				AVLTree<int> tree;
+
+				// Fill the tree with numbers.
+				for (int i = 0; i < 1000; ++i)
+					tree.Insert(i);
+
+				// Only the items in the range are visited, in sorted order.
+				int expected = 250;
+
+				tree.ForEachInRange(250, 500, [&expected](int _number) { Require(_number == expected++) });
+				Require(expected == 500)
+
+				// The number of items visited matches CountInRange().
+				unsigned int count = 0;
+				const auto countItems = [&count](int) { ++count; };
+
+				tree.ForEachInRange(-5, 2, countItems);
+				Require(count == tree.CountInRange(-5, 2))
+
+				count = 0;
+				tree.ForEachInRange(990, 2000, countItems);
+				Require(count == 10)
+
+				// Empty and reversed ranges visit nothing.
+				count = 0;
+				tree.ForEachInRange(5, 5, countItems);
+				tree.ForEachInRange(7, 3, countItems);
+				tree.ForEachInRange(2000, 3000, countItems);
+				Require(count == 0)
+			}
+
 			Subtest("ToArrayInorder()")
 			{
 				AVLTree<int> tree(
@@ -187,7 +454,7 @@ namespace UT
 				for (unsigned int i = 0; i < NUM_COUNT; ++i)
 					tree.Insert(numbers[i]);
 
-				const int expectedResult[NUM_COUNT] = { 4, 3, 2, 0, 1, 6, 5, 8, 7, 9 };
+				const int expectedResult[NUM_COUNT] = { 5, 3, 1, 0, 2, 4, 7, 6, 8, 9 };
 				int toArrayResult[NUM_COUNT] = { 0 };
 				tree.ToArrayPreorder(toArrayResult);
 
@@ -207,7 +474,7 @@ namespace UT
 				for (unsigned int i = 0; i < NUM_COUNT; ++i)
 					tree.Insert(numbers[i]);
 
-				const int expectedResult[NUM_COUNT] = { 1, 0, 2, 3, 5, 7, 9, 8, 6, 4 };
+				const int expectedResult[NUM_COUNT] = { 0, 2, 1, 4, 3, 6, 9, 8, 7, 5 };
 				int toArrayResult[NUM_COUNT] = { 0 };
 				tree.ToArrayPostorder(toArrayResult);
 
@@ -234,6 +501,377 @@ namespace UT
 				for (unsigned int i = 0; i < NUM_COUNT; ++i)
 					Require(toArrayResult[i] == NUM_COUNT - 1 - i);
 			}
+
+			Subtest("Iterators")
+			{
+				AVLTree<int> tree;
+
+				// An empty tree has nothing to walk.
+				Require(tree.begin() == tree.end())
+				Require(tree.rbegin() == tree.rend())
+
+				// Fill the tree with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				// A range-based for loop visits the items in sorted order.
+				int expected = 0;
+
+				for (int number : tree)
+					Require(number == expected++)
+
+				Require(expected == NUM_COUNT)
+
+				// Reverse iterators visit the items in reverse sorted order.
+				expected = NUM_COUNT - 1;
+
+				for (AVLTree<int>::ReverseIterator it = tree.rbegin(); it != tree.rend(); ++it)
+					Require(*it == expected--)
+
+				// Stepping back from the end gives the last item.
+				AVLTree<int>::Iterator it = tree.end();
+				Require(*--it == NUM_COUNT - 1)
+				Require(*it-- == NUM_COUNT - 1)
+				Require(*it == NUM_COUNT - 2)
+
+				// The standard algorithms work with the iterators, and can stop early.
+				Require(std::distance(tree.begin(), tree.end()) == NUM_COUNT)
+				Require(*std::find_if(tree.begin(), tree.end(), [](int _number) { return _number > 4; }) == 5)
+				Require(std::find(tree.begin(), tree.end(), 16) == tree.end())
+
+				// An iterator stays valid while other items are inserted and removed.
+				it = std::find(tree.begin(), tree.end(), 5);
+
+				for (int i = NUM_COUNT; i < 1000; ++i)
+					tree.Insert(i);
+
+				for (int i = 0; i < 1000; i += 2)
+					Require(tree.Remove(i))
+
+				Require(*it == 5)
+				Require(*++it == 7)
+
+				// Walking forward and backward matches the items in the tree after the changes.
+				int* inorder = new int[tree.Size()];
+				tree.ToArrayInorder(inorder);
+
+				unsigned int index = 0;
+
+				for (it = tree.begin(); it != tree.end(); ++it)
+					Require(*it == inorder[index++])
+
+				Require(index == tree.Size())
+
+				while (it != tree.begin())
+					Require(*--it == inorder[--index])
+
+				Require(index == 0)
+
+				delete[] inorder;
+			}
+
+			Subtest("Compare")
+			{
+				// Any function object can order the tree, including a std::function wrapping a lambda.
+				AVLTree<int, std::function<bool(const int&, const int&)>> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Fill the tree with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				int toArrayResult[NUM_COUNT] = { 0 };
+				tree.ToArrayInorder(toArrayResult);
+
+				// Test if the array is ordered highest to lowest.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(NUM_COUNT - 1 - i));
+
+				// Test finding and removing with the custom order.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(tree.Find(i) == true)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(tree.Remove(i) == true)
+
+				Require(tree.Size() == 0)
+
+				// A "lesser" and a "greater" function, as the tree used to take, can order it too.
+				AVLTree<int, std::function<bool(const int&, const int&)>> legacyTree(
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; }
+				);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					legacyTree.Insert(numbers[i]);
+
+				legacyTree.ToArrayInorder(toArrayResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(NUM_COUNT - 1 - i));
+
+				// The functions order the tree with the default Compare as well, even when they are not operator<.
+				AVLTree<int> defaultLegacyTree(
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; }
+				);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					defaultLegacyTree.Insert(numbers[i]);
+
+				defaultLegacyTree.ToArrayInorder(toArrayResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(NUM_COUNT - 1 - i))
+
+				Require(defaultLegacyTree.Find(0) == true)
+				Require(defaultLegacyTree.Remove(NUM_COUNT - 1) == true)
+				Require(defaultLegacyTree.Size() == NUM_COUNT - 1)
+			}
+
+			Subtest("Three-way Compare")
+			{
+				const std::string words[NUM_COUNT] = { "eight", "six", "seven", "five", "three", "zero", "nine", "four", "two", "one" };
+
+				// Count the calls to each comparison function.
+				unsigned int lesserCount = 0;
+				unsigned int threeWayCount = 0;
+
+				auto isLesser = [&lesserCount](const std::string& _lhs, const std::string& _rhs) { ++lesserCount; return _lhs < _rhs; };
+				auto threeWay = [&threeWayCount](const std::string& _lhs, const std::string& _rhs) { ++threeWayCount; return _lhs.compare(_rhs); };
+
+				AVLTree<std::string, decltype(isLesser)> lesserTree(isLesser);
+				AVLTree<std::string, decltype(threeWay)> threeWayTree(threeWay);
+
+				// Fill the trees with words.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					lesserTree.Insert(words[i]);
+					threeWayTree.Insert(words[i]);
+				}
+
+				// Test finding all words, counting only the comparisons made by Find().
+				lesserCount = threeWayCount = 0;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(lesserTree.Find(words[i]) == true)
+					Require(threeWayTree.Find(words[i]) == true)
+				}
+
+				Require(lesserTree.Find("ten") == false)
+				Require(threeWayTree.Find("ten") == false)
+
+				// A three-way comparison is made once per level, instead of up to twice.
+				Require(threeWayCount * 3 < lesserCount * 2)
+
+				// Test removing all words with the three-way comparison function.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(threeWayTree.Remove(words[i]) == true)
+
+				Require(threeWayTree.Remove("ten") == false)
+				Require(threeWayTree.Size() == 0)
+			}
+
+			Subtest("Allocator")
+			{
+				// Nodes come from a PoolAllocator by default. Any node allocator can be used instead.
+				AVLTree<int> poolTree;
+				AVLTree<int, std::less<int>, HeapAllocator> heapTree;
+
+				// Fill, clear, and refill the trees so that released nodes are allocated again.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					poolTree.Insert(numbers[i]);
+					heapTree.Insert(numbers[i]);
+				}
+
+				poolTree.Clear();
+				heapTree.Clear();
+
+				Require(poolTree.Size() == 0)
+				Require(heapTree.Size() == 0)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					poolTree.Insert(numbers[i]);
+					heapTree.Insert(numbers[i]);
+				}
+
+				int poolResult[NUM_COUNT] = { 0 };
+				int heapResult[NUM_COUNT] = { 0 };
+				poolTree.ToArrayInorder(poolResult);
+				heapTree.ToArrayInorder(heapResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(poolResult[i] == static_cast<int>(i))
+					Require(heapResult[i] == static_cast<int>(i))
+				}
+
+				// Types that must be destroyed are still visited one at a time by Clear().
+				AVLTree<std::string> stringTree;
+				stringTree.Insert("eight");
+				stringTree.Insert("six");
+				stringTree.Clear();
+				Require(stringTree.Find("six") == false)
+			}
+
+			Subtest("BuildFromSorted()")
+			{
+				constexpr unsigned int SORTED_COUNT = 1024;
+				int sortedNumbers[SORTED_COUNT];
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					sortedNumbers[i] = i;
+
+				// Build the tree in a tree that already has items. They are replaced.
+				AVLTree<int> tree;
+				tree.Insert(-16);
+				tree.BuildFromSorted(sortedNumbers, SORTED_COUNT);
+
+				Require(tree.Size() == SORTED_COUNT)
+				Require(tree.Find(-16) == false)
+
+				// 1024 items fit in 11 levels.
+				Require(tree.Height() == 11)
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					Require(tree.Select(i) == static_cast<int>(i))
+
+				// The built tree keeps working after items are inserted and removed.
+				for (unsigned int i = 0; i < SORTED_COUNT; i += 2)
+					Require(tree.Remove(i))
+
+				tree.Insert(SORTED_COUNT);
+				Require(tree.Size() == SORTED_COUNT / 2 + 1)
+				Require(tree.Select(0) == 1)
+				Require(tree.Select(SORTED_COUNT / 2) == SORTED_COUNT)
+			}
+
+			Subtest("Insert() many items")
+			{
+				// Unsorted items are sorted before the tree is built.
+				AVLTree<int> tree(numbers, NUM_COUNT);
+
+				Require(tree.Size() == NUM_COUNT)
+				Require(tree.Height() == 4)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(tree.Select(i) == static_cast<int>(i))
+
+				// A large batch is merged with the items in the tree, including items equal to items in the tree.
+				constexpr unsigned int BATCH_COUNT = 1000;
+				int batch[BATCH_COUNT];
+
+				for (unsigned int i = 0; i < BATCH_COUNT; ++i)
+					batch[i] = (i * 389) % BATCH_COUNT;
+
+				tree.Insert(batch, BATCH_COUNT);
+
+				Require(tree.Size() == NUM_COUNT + BATCH_COUNT)
+				Require(tree.Height() == 10)
+
+				for (unsigned int i = 0; i < NUM_COUNT * 2; ++i)
+					Require(tree.Select(i) == static_cast<int>(i / 2))
+
+				for (unsigned int i = NUM_COUNT * 2; i < NUM_COUNT + BATCH_COUNT; ++i)
+					Require(tree.Select(i) == static_cast<int>(i - NUM_COUNT))
+
+				// A small batch is inserted one item at a time.
+				tree.Insert(numbers, 2);
+
+				Require(tree.Size() == NUM_COUNT + BATCH_COUNT + 2)
+				Require(tree.CountInRange(numbers[0], numbers[0] + 1) == 3)
+				Require(tree.CountInRange(numbers[1], numbers[1] + 1) == 3)
+
+				// No items changes nothing.
+				tree.Insert(numbers, 0);
+				Require(tree.Size() == NUM_COUNT + BATCH_COUNT + 2)
+
+				// Types that must be copied with care are merged too.
+				const std::string words[NUM_COUNT] = { "eight", "six", "seven", "five", "three", "zero", "nine", "four", "two", "one" };
+				AVLTree<std::string> stringTree;
+
+				stringTree.Insert("ten");
+				stringTree.Insert(words, NUM_COUNT);
+
+				Require(stringTree.Size() == NUM_COUNT + 1)
+				Require(stringTree.Select(0) == "eight")
+				Require(stringTree.Select(NUM_COUNT) == "zero")
+			}
+
+			Subtest("Save() and Load()")
+			{
+				const char* path = "AVLTreeTest.bin";
+				AVLTree<int> tree;
+
+				// Fill the tree with numbers and save it.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				Require(tree.Save(path))
+
+				// Load the numbers into a tree that already has items. They are replaced.
+				AVLTree<int> loadedTree;
+				loadedTree.Insert(16);
+
+				Require(loadedTree.Load(path))
+				Require(loadedTree.Size() == NUM_COUNT)
+				Require(loadedTree.Find(16) == false)
+
+				// 10 items fit in 4 levels.
+				Require(loadedTree.Height() == 4)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(loadedTree.Select(i) == static_cast<int>(i))
+					Require(loadedTree.Rank(i) == i)
+				}
+
+				// The loaded tree keeps working after items are inserted and removed.
+				loadedTree.Insert(NUM_COUNT);
+				Require(loadedTree.Remove(0))
+				Require(loadedTree.Select(0) == 1)
+				Require(loadedTree.Select(NUM_COUNT - 1) == NUM_COUNT)
+
+				// A tree of a different type, or with a different order, can't load the file and is left unchanged.
+				AVLTree<double> doubleTree;
+				doubleTree.Insert(0.5);
+				Require(doubleTree.Load(path) == false)
+				Require(doubleTree.Size() == 1)
+
+				AVLTree<int, std::greater<int>> greaterTree;
+				Require(greaterTree.Load(path) == false)
+				Require(greaterTree.Size() == 0)
+
+				Require(tree.Load("AVLTreeTest.missing") == false)
+				Require(tree.Size() == NUM_COUNT)
+
+				// A large tree is loaded perfectly balanced.
+				constexpr unsigned int BULK_COUNT = 1 << 14;
+				tree.Clear();
+
+				for (unsigned int i = 0; i < BULK_COUNT; ++i)
+					tree.Insert((i * 40503) % BULK_COUNT);
+
+				Require(tree.Save(path))
+				Require(loadedTree.Load(path))
+				Require(loadedTree.Size() == BULK_COUNT)
+				Require(loadedTree.Height() == 15)
+
+				for (unsigned int i = 0; i < BULK_COUNT; i += 97)
+					Require(loadedTree.Select(i) == static_cast<int>(i))
+
+				// An empty tree can be saved and loaded.
+				tree.Clear();
+				Require(tree.Save(path))
+				Require(loadedTree.Load(path))
+				Require(loadedTree.Size() == 0)
+
+				std::remove(path);
+			}
 		}
 	}
 }
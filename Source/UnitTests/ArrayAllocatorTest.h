@@ -0,0 +1,131 @@
+/*
+	FILE: ArrayAllocatorTest.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Tests the interface of the array allocators and also demonstrates how they can be used.
+*/
+
+#pragma once
+
+#include <cstdint> // Used for uintptr_t.
+
+#include "../UnitTests/UnitTest.h"
+#include "../DataStructures/ArrayAllocator.h"
+#include "../DataStructures/DynamicArray.h"
+
+namespace UT
+{
+	void TestArrayAllocator()
+	{
+		Test("ArrayAllocator")
+		{
+			constexpr unsigned int NUM_COUNT = 10;
+
+			Subtest("HeapArrayAllocator")
+			{
+				HeapArrayAllocator<int> allocator;
+
+				// Allocate, construct, and check each item.
+				int* items = allocator.Allocate(NUM_COUNT);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					items[i] = i;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(items[i] == static_cast<int>(i))
+
+				allocator.Deallocate(items, NUM_COUNT);
+			}
+
+			Subtest("AlignedArrayAllocator")
+			{
+				AlignedArrayAllocator<char, 64> allocator1;
+				AlignedArrayAllocator<double, 4096> allocator2;
+
+				// Test that every allocation starts on the boundary.
+				for (unsigned int i = 1; i <= NUM_COUNT; ++i)
+				{
+					char* items1 = allocator1.Allocate(i);
+					double* items2 = allocator2.Allocate(i);
+
+					Require(reinterpret_cast<uintptr_t>(items1) % 64 == 0)
+					Require(reinterpret_cast<uintptr_t>(items2) % 4096 == 0)
+
+					items1[i - 1] = 'a';
+					items2[i - 1] = 0.5;
+
+					allocator1.Deallocate(items1, i);
+					allocator2.Deallocate(items2, i);
+				}
+			}
+
+			Subtest("HugePageArrayAllocator")
+			{
+				constexpr unsigned int HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+				// Use a small threshold, so that both small and large arrays can be tested cheaply.
+				HugePageArrayAllocator<int, 64, 4096> allocator;
+
+				// Small arrays are aligned to the alignment.
+				int* items1 = allocator.Allocate(NUM_COUNT);
+				Require(reinterpret_cast<uintptr_t>(items1) % 64 == 0)
+
+				// Large arrays are aligned to a huge page on Linux.
+				int* items2 = allocator.Allocate(HUGE_PAGE_SIZE / sizeof(int) + 1);
+#if defined(__linux__)
+				Require(reinterpret_cast<uintptr_t>(items2) % HUGE_PAGE_SIZE == 0)
+#endif
+				Require(reinterpret_cast<uintptr_t>(items2) % 64 == 0)
+
+				// Test that all the memory can be written.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					items1[i] = i;
+
+				for (unsigned int i = 0; i <= HUGE_PAGE_SIZE / sizeof(int); i += 1024)
+					items2[i] = i;
+
+				items2[HUGE_PAGE_SIZE / sizeof(int)] = 16;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(items1[i] == static_cast<int>(i))
+
+				Require(items2[HUGE_PAGE_SIZE / sizeof(int)] == 16)
+
+				allocator.Deallocate(items1, NUM_COUNT);
+				allocator.Deallocate(items2, HUGE_PAGE_SIZE / sizeof(int) + 1);
+			}
+
+			Subtest("DynamicArray")
+			{
+				DynamicArray<float, 0, DoublingGrowth, CacheAlignedArrayAllocator> dynArray1;
+				DynamicArray<float, 0, DoublingGrowth, HugePageAllocator> dynArray2;
+
+				// The storage stays aligned as the arrays grow past the huge page threshold.
+				for (unsigned int i = 0; i < (1 << 20); ++i)
+				{
+					dynArray1.Append(static_cast<float>(i));
+					dynArray2.Append(static_cast<float>(i));
+
+					if ((i & (i + 1)) == 0)
+					{
+						Require(reinterpret_cast<uintptr_t>(&dynArray1[0]) % 64 == 0)
+						Require(reinterpret_cast<uintptr_t>(&dynArray2[0]) % 64 == 0)
+					}
+				}
+
+				for (unsigned int i = 0; i < (1 << 20); i += 1024)
+				{
+					Require(dynArray1[i] == static_cast<float>(i))
+					Require(dynArray2[i] == static_cast<float>(i))
+				}
+
+				// Copies use the same allocator.
+				DynamicArray<float, 0, DoublingGrowth, HugePageAllocator> dynArray3(dynArray2);
+
+				Require(dynArray3.Size() == (1 << 20))
+				Require(dynArray3[(1 << 20) - 1] == static_cast<float>((1 << 20) - 1))
+			}
+		}
+	}
+}
@@ -2,13 +2,17 @@
 	FILE: BinarySearchTreeTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 26, 2021
-	MODIFIED: January 27, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the interface of the Binary Search Tree and also demonstrates how the data
 		structure can be used.
 */
 
 #pragma once
 
+#include <algorithm> // Used for std::find and std::find_if.
+#include <cstdio> // Used for std::remove.
+#include <iterator> // Used for std::distance.
+
 #include "../UnitTests/UnitTest.h"
 #include "../DataStructures/BinarySearchTree.h"
 
@@ -136,6 +140,133 @@ namespace UT
 				}
 
 				Require(tree.Size() == NUM_COUNT)
+
+				// A copy should report the same number of items.
+				BinarySearchTree<int> treeCopy(tree);
+				Require(treeCopy.Size() == NUM_COUNT)
+			}
+
+			Subtest("Size() is kept current")
+			{
+				BinarySearchTree<int> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Insert the keys in a scrambled order. Multiplying by an odd number visits every key exactly once.
+				constexpr unsigned int BULK_COUNT = 1 << 16;
+				bool isSizeCorrect = true;
+
+				for (unsigned int i = 0; i < BULK_COUNT; ++i)
+				{
+					tree.Insert((i * 40503) % BULK_COUNT);
+					isSizeCorrect = isSizeCorrect && tree.Size() == i + 1;
+				}
+
+				Require(isSizeCorrect)
+
+				// Remove the even keys. Removing keys that aren't in the tree must not change the size.
+				for (unsigned int i = 0; i < BULK_COUNT; i += 2)
+				{
+					isSizeCorrect = isSizeCorrect && tree.Remove(i) && tree.Size() == BULK_COUNT - i / 2 - 1;
+					isSizeCorrect = isSizeCorrect && !tree.Remove(i) && !tree.Remove(BULK_COUNT + i);
+					isSizeCorrect = isSizeCorrect && tree.Size() == BULK_COUNT - i / 2 - 1;
+				}
+
+				Require(isSizeCorrect)
+				Require(tree.Size() == BULK_COUNT / 2)
+
+				// Call Size() 2^20 times on the large tree, inserting or removing an item before each call. Kept current, 
+				// this takes a few million steps. Counted by walking the tree, it would take 2^35 node visits, and the 
+				// tests would not finish.
+				constexpr unsigned int SIZE_CALL_COUNT = 1 << 20;
+				unsigned long long sizeTotal = 0;
+
+				for (unsigned int i = 0; i < SIZE_CALL_COUNT; ++i)
+				{
+					if (i % 2 == 0)
+						tree.Insert(BULK_COUNT);
+					else
+						tree.Remove(BULK_COUNT);
+
+					sizeTotal += tree.Size();
+				}
+
+				Require(sizeTotal == static_cast<unsigned long long>(SIZE_CALL_COUNT) * (BULK_COUNT / 2) + SIZE_CALL_COUNT / 2)
+
+				tree.Clear();
+				Require(tree.Size() == 0)
+
+				tree.Insert(1);
+				Require(tree.Size() == 1)
+			}
+
+			Subtest("Sorted Insert() without recursion")
+			{
+				// Sorted items make every node a right child, so the tree is as deep as it is large. The recursive
+				// version of the tree overflowed a 1 MB call stack at this depth.
+				constexpr unsigned int SORTED_COUNT = 1 << 15;
+				BinarySearchTree<int> tree;
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					tree.Insert(i);
+
+				Require(tree.Size() == SORTED_COUNT)
+
+				for (unsigned int i = 0; i < SORTED_COUNT; i += 1021)
+					Require(tree.Find(i))
+
+				Require(tree.Find(SORTED_COUNT) == false)
+
+				// Every traversal visits all of the nodes.
+				int* toArrayResult = new int[SORTED_COUNT];
+
+				tree.ToArrayInorder(toArrayResult);
+				Require(toArrayResult[0] == 0)
+				Require(toArrayResult[SORTED_COUNT - 1] == SORTED_COUNT - 1)
+
+				tree.ToArrayPreorder(toArrayResult);
+				Require(toArrayResult[0] == 0)
+				Require(toArrayResult[SORTED_COUNT - 1] == SORTED_COUNT - 1)
+
+				tree.ToArrayPostorder(toArrayResult);
+				Require(toArrayResult[0] == SORTED_COUNT - 1)
+				Require(toArrayResult[SORTED_COUNT - 1] == 0)
+
+				tree.ToArrayInReverseOrder(toArrayResult);
+				Require(toArrayResult[0] == SORTED_COUNT - 1)
+				Require(toArrayResult[SORTED_COUNT - 1] == 0)
+
+				// A copy has the same shape, so its preorder is the same.
+				BinarySearchTree<int> treeCopy(tree);
+				int* copyResult = new int[SORTED_COUNT];
+
+				tree.ToArrayPreorder(toArrayResult);
+				treeCopy.ToArrayPreorder(copyResult);
+
+				Require(treeCopy.Size() == SORTED_COUNT)
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					Require(copyResult[i] == toArrayResult[i])
+
+				delete[] toArrayResult;
+				delete[] copyResult;
+
+				// Remove from the bottom, the top, and the middle of the tree.
+				Require(tree.Remove(SORTED_COUNT - 1))
+				Require(tree.Remove(0))
+				Require(tree.Remove(SORTED_COUNT / 2))
+				Require(tree.Remove(SORTED_COUNT / 2) == false)
+				Require(tree.Size() == SORTED_COUNT - 3)
+
+				// Items that must be destroyed are destroyed one at a time.
+				BinarySearchTree<std::string> stringTree;
+
+				for (unsigned int i = 0; i < 1024; ++i)
+					stringTree.Insert(std::to_string(1000000 + i));
+
+				stringTree.Clear();
+				Require(stringTree.Size() == 0)
 			}
 
 			Subtest("ToArrayInorder()")
@@ -215,6 +346,375 @@ namespace UT
 				for (unsigned int i = 0; i < NUM_COUNT; ++i)
 					Require(toArrayResult[i] == NUM_COUNT - 1 - i);
 			}
+
+			Subtest("Iterators")
+			{
+				BinarySearchTree<int> tree;
+
+				// An empty tree has nothing to walk.
+				Require(tree.begin() == tree.end())
+				Require(tree.rbegin() == tree.rend())
+
+				// Fill the tree with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				// A range-based for loop visits the items in sorted order.
+				int expected = 0;
+
+				for (int number : tree)
+					Require(number == expected++)
+
+				Require(expected == NUM_COUNT)
+
+				// Reverse iterators visit the items in reverse sorted order.
+				expected = NUM_COUNT - 1;
+
+				for (BinarySearchTree<int>::ReverseIterator it = tree.rbegin(); it != tree.rend(); ++it)
+					Require(*it == expected--)
+
+				// Stepping back from the end gives the last item.
+				BinarySearchTree<int>::Iterator it = tree.end();
+				Require(*--it == NUM_COUNT - 1)
+				Require(*it-- == NUM_COUNT - 1)
+				Require(*it == NUM_COUNT - 2)
+
+				// The standard algorithms work with the iterators, and can stop early.
+				Require(std::distance(tree.begin(), tree.end()) == NUM_COUNT)
+				Require(*std::find_if(tree.begin(), tree.end(), [](int _number) { return _number > 4; }) == 5)
+				Require(std::find(tree.begin(), tree.end(), 16) == tree.end())
+
+				// An iterator stays valid while other items are inserted and removed.
+				it = std::find(tree.begin(), tree.end(), 5);
+
+				for (int i = NUM_COUNT; i < 1000; ++i)
+					tree.Insert(i);
+
+				for (int i = 0; i < 1000; i += 2)
+					Require(tree.Remove(i))
+
+				Require(*it == 5)
+				Require(*++it == 7)
+
+				// Walking forward and backward matches the items in the tree after the changes.
+				int* inorder = new int[tree.Size()];
+				tree.ToArrayInorder(inorder);
+
+				unsigned int index = 0;
+
+				for (it = tree.begin(); it != tree.end(); ++it)
+					Require(*it == inorder[index++])
+
+				Require(index == tree.Size())
+
+				while (it != tree.begin())
+					Require(*--it == inorder[--index])
+
+				Require(index == 0)
+
+				delete[] inorder;
+			}
+
+			Subtest("Compare")
+			{
+				// Any function object can order the tree, including a std::function wrapping a lambda.
+				BinarySearchTree<int, std::function<bool(const int&, const int&)>> tree(
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; }
+				);
+
+				// Fill the tree with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					tree.Insert(numbers[i]);
+
+				int toArrayResult[NUM_COUNT] = { 0 };
+				tree.ToArrayInorder(toArrayResult);
+
+				// Test if the array is ordered highest to lowest.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(NUM_COUNT - 1 - i));
+
+				// Test finding and removing with the custom order.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(tree.Find(i) == true)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(tree.Remove(i) == true)
+
+				Require(tree.Size() == 0)
+
+				// A "lesser" and a "greater" function, as the tree used to take, can order it too.
+				BinarySearchTree<int, std::function<bool(const int&, const int&)>> legacyTree(
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; }
+				);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					legacyTree.Insert(numbers[i]);
+
+				legacyTree.ToArrayInorder(toArrayResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(NUM_COUNT - 1 - i));
+
+				// The functions order the tree with the default Compare as well, even when they are not operator<.
+				BinarySearchTree<int> defaultLegacyTree(
+					[](const int& _lhs, const int& _rhs) { return _lhs > _rhs; },
+					[](const int& _lhs, const int& _rhs) { return _lhs < _rhs; }
+				);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					defaultLegacyTree.Insert(numbers[i]);
+
+				defaultLegacyTree.ToArrayInorder(toArrayResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(NUM_COUNT - 1 - i))
+
+				Require(defaultLegacyTree.Find(0) == true)
+				Require(defaultLegacyTree.Remove(NUM_COUNT - 1) == true)
+				Require(defaultLegacyTree.Size() == NUM_COUNT - 1)
+			}
+
+			Subtest("Three-way Compare")
+			{
+				const std::string words[NUM_COUNT] = { "eight", "six", "seven", "five", "three", "zero", "nine", "four", "two", "one" };
+
+				// Count the calls to each comparison function.
+				unsigned int lesserCount = 0;
+				unsigned int threeWayCount = 0;
+
+				auto isLesser = [&lesserCount](const std::string& _lhs, const std::string& _rhs) { ++lesserCount; return _lhs < _rhs; };
+				auto threeWay = [&threeWayCount](const std::string& _lhs, const std::string& _rhs) { ++threeWayCount; return _lhs.compare(_rhs); };
+
+				BinarySearchTree<std::string, decltype(isLesser)> lesserTree(isLesser);
+				BinarySearchTree<std::string, decltype(threeWay)> threeWayTree(threeWay);
+
+				// Fill the trees with words.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					lesserTree.Insert(words[i]);
+					threeWayTree.Insert(words[i]);
+				}
+
+				// Test finding all words, counting only the comparisons made by Find().
+				lesserCount = threeWayCount = 0;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(lesserTree.Find(words[i]) == true)
+					Require(threeWayTree.Find(words[i]) == true)
+				}
+
+				Require(lesserTree.Find("ten") == false)
+				Require(threeWayTree.Find("ten") == false)
+
+				// A three-way comparison is made once per level, instead of up to twice.
+				Require(threeWayCount * 3 < lesserCount * 2)
+
+				// Test removing all words with the three-way comparison function.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(threeWayTree.Remove(words[i]) == true)
+
+				Require(threeWayTree.Remove("ten") == false)
+				Require(threeWayTree.Size() == 0)
+			}
+
+			Subtest("Allocator")
+			{
+				// Nodes come from a PoolAllocator by default. Any node allocator can be used instead.
+				BinarySearchTree<int> poolTree;
+				BinarySearchTree<int, std::less<int>, HeapAllocator> heapTree;
+
+				// Fill, clear, and refill the trees so that released nodes are allocated again.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					poolTree.Insert(numbers[i]);
+					heapTree.Insert(numbers[i]);
+				}
+
+				poolTree.Clear();
+				heapTree.Clear();
+
+				Require(poolTree.Size() == 0)
+				Require(heapTree.Size() == 0)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					poolTree.Insert(numbers[i]);
+					heapTree.Insert(numbers[i]);
+				}
+
+				int poolResult[NUM_COUNT] = { 0 };
+				int heapResult[NUM_COUNT] = { 0 };
+				poolTree.ToArrayInorder(poolResult);
+				heapTree.ToArrayInorder(heapResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(poolResult[i] == static_cast<int>(i))
+					Require(heapResult[i] == static_cast<int>(i))
+				}
+
+				// Types that must be destroyed are still visited one at a time by Clear().
+				BinarySearchTree<std::string> stringTree;
+				stringTree.Insert("eight");
+				stringTree.Insert("six");
+				stringTree.Clear();
+				Require(stringTree.Find("six") == false)
+			}
+
+			Subtest("BuildFromSorted()")
+			{
+				constexpr unsigned int SORTED_COUNT = 1023;
+				int sortedNumbers[SORTED_COUNT];
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					sortedNumbers[i] = i;
+
+				// Build the tree in a tree that already has items. They are replaced.
+				BinarySearchTree<int> tree;
+				tree.Insert(-16);
+				tree.BuildFromSorted(sortedNumbers, SORTED_COUNT);
+
+				Require(tree.Size() == SORTED_COUNT)
+				Require(tree.Find(-16) == false)
+
+				// The tree is balanced. The middle number is the root, and the quarters are its children.
+				int preorderResult[SORTED_COUNT] = { 0 };
+				tree.ToArrayPreorder(preorderResult);
+
+				Require(preorderResult[0] == SORTED_COUNT / 2)
+				Require(preorderResult[1] == SORTED_COUNT / 4)
+				Require(preorderResult[SORTED_COUNT / 2 + 1] == SORTED_COUNT / 2 + SORTED_COUNT / 4 + 1)
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					Require(tree.Find(i))
+			}
+
+			Subtest("Insert() many items")
+			{
+				// Unsorted items are sorted before the tree is built.
+				BinarySearchTree<int> tree(numbers, NUM_COUNT);
+
+				Require(tree.Size() == NUM_COUNT)
+
+				int toArrayResult[NUM_COUNT] = { 0 };
+				tree.ToArrayInorder(toArrayResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(toArrayResult[i] == static_cast<int>(i))
+
+				// A large batch is merged with the items in the tree, including items equal to items in the tree.
+				constexpr unsigned int BATCH_COUNT = 1000;
+				int batch[BATCH_COUNT];
+
+				for (unsigned int i = 0; i < BATCH_COUNT; ++i)
+					batch[i] = (i * 389) % BATCH_COUNT;
+
+				tree.Insert(batch, BATCH_COUNT);
+
+				Require(tree.Size() == NUM_COUNT + BATCH_COUNT)
+
+				int mergedResult[NUM_COUNT + BATCH_COUNT] = { 0 };
+				tree.ToArrayInorder(mergedResult);
+
+				for (unsigned int i = 0; i < NUM_COUNT * 2; ++i)
+					Require(mergedResult[i] == static_cast<int>(i / 2))
+
+				for (unsigned int i = NUM_COUNT * 2; i < NUM_COUNT + BATCH_COUNT; ++i)
+					Require(mergedResult[i] == static_cast<int>(i - NUM_COUNT))
+
+				// The merged tree is balanced, so the middle item is the root.
+				tree.ToArrayPreorder(mergedResult);
+				Require(mergedResult[0] == (NUM_COUNT + BATCH_COUNT) / 2 - NUM_COUNT)
+
+				// A small batch is inserted one item at a time.
+				tree.Insert(numbers, 2);
+				Require(tree.Size() == NUM_COUNT + BATCH_COUNT + 2)
+
+				// No items changes nothing.
+				tree.Insert(numbers, 0);
+				Require(tree.Size() == NUM_COUNT + BATCH_COUNT + 2)
+
+				// Types that must be copied with care are merged too.
+				const std::string words[NUM_COUNT] = { "eight", "six", "seven", "five", "three", "zero", "nine", "four", "two", "one" };
+				BinarySearchTree<std::string> stringTree;
+
+				stringTree.Insert("ten");
+				stringTree.Insert(words, NUM_COUNT);
+
+				std::string wordsResult[NUM_COUNT + 1];
+				stringTree.ToArrayInorder(wordsResult);
+
+				Require(stringTree.Size() == NUM_COUNT + 1)
+				Require(wordsResult[0] == "eight")
+				Require(wordsResult[NUM_COUNT - 3] == "ten")
+				Require(wordsResult[NUM_COUNT] == "zero")
+			}
+
+			Subtest("Save() and Load()")
+			{
+				const char* path = "BinarySearchTreeTest.bin";
+				BinarySearchTree<int> tree;
+
+				// Insert the numbers in order, so every node only has a right child.
+				constexpr unsigned int SORTED_COUNT = 1023;
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					tree.Insert(i);
+
+				Require(tree.Save(path))
+
+				// Load the numbers into a tree that already has items. They are replaced.
+				BinarySearchTree<int> loadedTree;
+				loadedTree.Insert(-16);
+
+				Require(loadedTree.Load(path))
+				Require(loadedTree.Size() == SORTED_COUNT)
+				Require(loadedTree.Find(-16) == false)
+
+				// The loaded tree is balanced. The middle number is the root, and the quarters are its children.
+				int preorderResult[SORTED_COUNT] = { 0 };
+				loadedTree.ToArrayPreorder(preorderResult);
+
+				Require(preorderResult[0] == SORTED_COUNT / 2)
+				Require(preorderResult[1] == SORTED_COUNT / 4)
+				Require(preorderResult[SORTED_COUNT / 2 + 1] == SORTED_COUNT / 2 + SORTED_COUNT / 4 + 1)
+
+				int inorderResult[SORTED_COUNT] = { 0 };
+				loadedTree.ToArrayInorder(inorderResult);
+
+				for (unsigned int i = 0; i < SORTED_COUNT; ++i)
+					Require(inorderResult[i] == static_cast<int>(i))
+
+				// The loaded tree keeps working after items are inserted and removed.
+				loadedTree.Insert(SORTED_COUNT);
+				Require(loadedTree.Remove(SORTED_COUNT / 2))
+				Require(loadedTree.Find(SORTED_COUNT))
+				Require(loadedTree.Find(SORTED_COUNT / 2) == false)
+				Require(loadedTree.Size() == SORTED_COUNT)
+
+				// A tree of a different type, or with a different order, can't load the file and is left unchanged.
+				BinarySearchTree<double> doubleTree;
+				doubleTree.Insert(0.5);
+				Require(doubleTree.Load(path) == false)
+				Require(doubleTree.Size() == 1)
+
+				BinarySearchTree<int, std::greater<int>> greaterTree;
+				Require(greaterTree.Load(path) == false)
+				Require(greaterTree.Size() == 0)
+
+				Require(tree.Load("BinarySearchTreeTest.missing") == false)
+				Require(tree.Size() == SORTED_COUNT)
+
+				// An empty tree can be saved and loaded.
+				tree.Clear();
+				Require(tree.Save(path))
+				Require(loadedTree.Load(path))
+				Require(loadedTree.Size() == 0)
+
+				std::remove(path);
+			}
 		}
 	}
 }
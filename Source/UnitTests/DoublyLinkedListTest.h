@@ -2,7 +2,7 @@
 	FILE: DoublyLinkedListTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 27, 2021
-	MODIFIED: January 29, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the interface of the Doubly-Linked Lsit and also demonstrates how the data
 		structure can be used.
 */
@@ -347,6 +347,38 @@ namespace UT
 
 				Require(list.PeekTail() == nullptr);
 			}
+
+			Subtest("PoolAllocator")
+			{
+				constexpr unsigned int HALF_COUNT = NUM_COUNT / 2;
+
+				DoublyLinkedList<int, PoolAllocator> list;
+
+				// Fill the list, remove half of the numbers, and fill it again so that freed nodes are reused.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					list.AddTail(numbers[i]);
+
+				for (unsigned int i = 0; i < HALF_COUNT; ++i)
+					list.RemoveHead();
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					list.AddTail(numbers[i]);
+
+				Require(list.Size() == NUM_COUNT + HALF_COUNT)
+
+				// Check that all numbers are in the list in order, including in a copy of the list.
+				const int expectedResult[NUM_COUNT + HALF_COUNT] = { 0, 9, 4, 2, 1, 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+				DoublyLinkedList<int, PoolAllocator> listCopy(list);
+
+				unsigned int i = 0;
+				for (DoublyLinkedList<int, PoolAllocator>::Node* iter = listCopy.PeekHead(); iter; iter = iter->Next())
+					Require(iter->Data() == expectedResult[i++]);
+
+				Require(i == NUM_COUNT + HALF_COUNT)
+
+				list.Clear();
+				Require(list.Size() == 0)
+			}
 		}
 	}
 }
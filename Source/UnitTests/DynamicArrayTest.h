@@ -2,18 +2,58 @@
 	FILE: DynamicArrayTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 27, 2021
-	MODIFIED: January 27, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the interface of the Dynamic Array and also demonstrates how the data structure
 		can be used.
 */
 
 #pragma once
 
+#include <limits> // Used for the largest capacity a growth policy can return.
+
 #include "../UnitTests/UnitTest.h"
 #include "../DataStructures/DynamicArray.h"
 
 namespace UT
 {
+	namespace
+	{
+		/*
+			DESCRIPTION: A string that counts how many times it is copied, to test that items are moved instead.
+		*/
+		struct CountedString
+		{
+			static unsigned int copies; // Number of copies made of any CountedString.
+			std::string text;
+
+			CountedString() = default;
+			CountedString(const char* _text) : text(_text) {}
+			CountedString(const CountedString& _other) : text(_other.text) { ++copies; }
+			CountedString(CountedString&& _other) = default;
+			CountedString& operator=(const CountedString& _other) { text = _other.text; ++copies; return *this; }
+			CountedString& operator=(CountedString&& _other) = default;
+		};
+
+		unsigned int CountedString::copies = 0;
+
+		/*
+			DESCRIPTION: An item without a default constructor that counts how many items are alive, to test that the 
+				array only constructs the items it holds.
+		*/
+		struct CountedItem
+		{
+			static int alive; // Number of CountedItems constructed and not yet destroyed.
+			int value;
+
+			explicit CountedItem(int _value) : value(_value) { ++alive; }
+			CountedItem(const CountedItem& _other) : value(_other.value) { ++alive; }
+			CountedItem& operator=(const CountedItem& _other) = default;
+			~CountedItem() { --alive; }
+		};
+
+		int CountedItem::alive = 0;
+	}
+
 	void TestDynamicArray()
 	{
 		Test("DynamicArray")
@@ -249,6 +289,537 @@ namespace UT
 				dynArray.ShrinkToFit();
 				Require(dynArray.Capacity() == dynArray.Size())
 			}
+
+			Subtest("Copy")
+			{
+				DynamicArray<std::string> dynArray1;
+
+				// Fill the array with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					dynArray1.Append(std::to_string(numbers[i]));
+
+				// Test copy construction and copy assignment.
+				DynamicArray<std::string> dynArray2(dynArray1);
+				DynamicArray<std::string> dynArray3;
+				dynArray3.Append("16");
+				dynArray3 = dynArray1;
+
+				Require(dynArray2.Size() == NUM_COUNT)
+				Require(dynArray3.Size() == NUM_COUNT)
+
+				// Changing the original array should not change the copies.
+				dynArray1[0] = "1024";
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(dynArray2[i] == std::to_string(numbers[i]))
+					Require(dynArray3[i] == std::to_string(numbers[i]))
+				}
+			}
+
+			Subtest("Move")
+			{
+				DynamicArray<int> dynArray1;
+
+				// Fill the array with numbers.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					dynArray1.Append(numbers[i]);
+
+				// Test move construction. The moved array is left empty.
+				DynamicArray<int> dynArray2(std::move(dynArray1));
+
+				Require(dynArray1.Size() == 0)
+				Require(dynArray1.Capacity() == 0)
+				Require(dynArray2.Size() == NUM_COUNT)
+
+				// Test move assignment.
+				DynamicArray<int> dynArray3;
+				dynArray3.Append(16);
+				dynArray3 = std::move(dynArray2);
+
+				Require(dynArray2.Size() == 0)
+				Require(dynArray3.Size() == NUM_COUNT)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(dynArray3[i] == numbers[i])
+			}
+
+			Subtest("Append() and Insert() by move")
+			{
+				DynamicArray<CountedString> dynArray;
+				CountedString::copies = 0;
+
+				// Growing the array many times should move the items instead of copying them.
+				for (unsigned int i = 0; i < NUM_COUNT * 100; ++i)
+				{
+					CountedString item("a string too long for the small string optimization");
+					dynArray.Append(std::move(item));
+				}
+
+				CountedString item("inserted");
+				dynArray.Insert(NUM_COUNT, std::move(item));
+				dynArray.Remove(0);
+
+				Require(CountedString::copies == 0)
+				Require(dynArray.Size() == NUM_COUNT * 100)
+				Require(dynArray[NUM_COUNT - 1].text == "inserted")
+			}
+
+			Subtest("EmplaceBack() and Emplace()")
+			{
+				DynamicArray<std::string> dynArray;
+
+				// Construct strings of repeated characters in the array.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					dynArray.EmplaceBack(numbers[i] + 1, 'a' + numbers[i]);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(dynArray[i] == std::string(numbers[i] + 1, 'a' + numbers[i]))
+
+				// Construct a string at the front and in the middle of the array.
+				dynArray.Emplace(0, 3, 'z');
+				dynArray.Emplace(NUM_COUNT / 2, "middle");
+
+				Require(dynArray.Size() == NUM_COUNT + 2)
+				Require(dynArray[0] == "zzz")
+				Require(dynArray[NUM_COUNT / 2] == "middle")
+				Require(dynArray[NUM_COUNT + 1] == std::string(numbers[NUM_COUNT - 1] + 1, 'a' + numbers[NUM_COUNT - 1]))
+			}
+
+			Subtest("Uninitialized capacity")
+			{
+				{
+					DynamicArray<CountedItem> dynArray1;
+
+					// Reserving space should not construct any items.
+					dynArray1.Reserve(1 << 20);
+					Require(CountedItem::alive == 0)
+
+					for (unsigned int i = 0; i < NUM_COUNT; ++i)
+						dynArray1.EmplaceBack(numbers[i]);
+
+					Require(CountedItem::alive == NUM_COUNT)
+
+					dynArray1.Remove(0);
+					dynArray1.Insert(4, CountedItem(16));
+					Require(CountedItem::alive == NUM_COUNT)
+
+					// Shrinking below the size destroys the items that no longer fit.
+					dynArray1.Reserve(NUM_COUNT / 2);
+					Require(CountedItem::alive == NUM_COUNT / 2)
+
+					const int expectedResult[NUM_COUNT / 2] = { 6, 7, 5, 3, 16 };
+					for (unsigned int i = 0; i < NUM_COUNT / 2; ++i)
+						Require(dynArray1[i].value == expectedResult[i])
+
+					DynamicArray<CountedItem> dynArray2(dynArray1);
+					Require(CountedItem::alive == NUM_COUNT)
+
+					dynArray1.Clear();
+					Require(CountedItem::alive == NUM_COUNT / 2)
+				}
+
+				// The destructor destroys the remaining items.
+				Require(CountedItem::alive == 0)
+			}
+
+			Subtest("Append() an item of the array")
+			{
+				DynamicArray<std::string> dynArray;
+				dynArray.Append("a string too long for the small string optimization");
+
+				// Appending an item of the array while the array grows should not read the item after it moved.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(dynArray.Size() == dynArray.Capacity())
+					dynArray.Append(dynArray[0]);
+					dynArray.Append(dynArray[dynArray.Size() - 1]);
+					dynArray.Insert(0, dynArray[dynArray.Size() - 1]);
+					dynArray.ShrinkToFit();
+				}
+
+				Require(dynArray.Size() == NUM_COUNT * 3 + 1)
+
+				for (unsigned int i = 0; i < dynArray.Size(); ++i)
+					Require(dynArray[i] == "a string too long for the small string optimization")
+			}
+
+			Subtest("AppendRange()")
+			{
+				DynamicArray<int> dynArray1;
+
+				// Append the numbers in two ranges, then append the array to itself.
+				dynArray1.AppendRange(numbers, NUM_COUNT / 2);
+				dynArray1.AppendRange(numbers + NUM_COUNT / 2, NUM_COUNT / 2);
+				dynArray1.AppendRange(&dynArray1[0], NUM_COUNT);
+
+				Require(dynArray1.Size() == NUM_COUNT * 2)
+				Require(dynArray1.Capacity() == 32)
+
+				for (unsigned int i = 0; i < NUM_COUNT * 2; ++i)
+					Require(dynArray1[i] == numbers[i % NUM_COUNT])
+
+				// Test the same with items that are not trivially copyable.
+				DynamicArray<std::string> dynArray2;
+				dynArray2.Append("a string too long for the small string optimization");
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					dynArray2.AppendRange(&dynArray2[0], dynArray2.Size());
+
+				Require(dynArray2.Size() == 1 << NUM_COUNT)
+
+				for (unsigned int i = 0; i < dynArray2.Size(); ++i)
+					Require(dynArray2[i] == "a string too long for the small string optimization")
+			}
+
+			Subtest("InsertRange()")
+			{
+				const int range[3] = { 16, 32, 64 };
+				const std::string stringRange[3] = { "16", "32", "64" };
+
+				DynamicArray<int> dynArray1;
+				DynamicArray<std::string> dynArray2;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					dynArray1.Append(numbers[i]);
+					dynArray2.Append(std::to_string(numbers[i]));
+				}
+
+				// Insert at the front, in the middle, at the end, and near the end so that items move past the end.
+				dynArray1.Reserve(24);
+				dynArray2.Reserve(24);
+
+				const unsigned int indices[4] = { 0, 5, 16, 18 };
+
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					dynArray1.InsertRange(indices[i], range, 3);
+					dynArray2.InsertRange(indices[i], stringRange, 3);
+				}
+
+				// Insert enough to grow the array.
+				dynArray1.InsertRange(1, range, 3);
+				dynArray2.InsertRange(1, stringRange, 3);
+
+				const int expectedResult[NUM_COUNT + 15] = 
+					{ 16, 16, 32, 64, 32, 64, 8, 6, 16, 32, 64, 7, 5, 3, 0, 9, 4, 2, 1, 16, 32, 16, 32, 64, 64 };
+
+				Require(dynArray1.Size() == NUM_COUNT + 15)
+				Require(dynArray2.Size() == NUM_COUNT + 15)
+				Require(dynArray1.Capacity() == 48)
+
+				for (unsigned int i = 0; i < NUM_COUNT + 15; ++i)
+				{
+					Require(dynArray1[i] == expectedResult[i])
+					Require(dynArray2[i] == std::to_string(expectedResult[i]))
+				}
+			}
+
+			Subtest("RemoveRange()")
+			{
+				{
+					DynamicArray<int> dynArray1;
+					DynamicArray<CountedItem> dynArray2;
+
+					for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					{
+						dynArray1.Append(numbers[i]);
+						dynArray2.EmplaceBack(numbers[i]);
+					}
+
+					// Remove from the middle, from the front, nothing, and then from the end.
+					dynArray1.RemoveRange(3, 2);
+					dynArray2.RemoveRange(3, 2);
+					dynArray1.RemoveRange(0, 1);
+					dynArray2.RemoveRange(0, 1);
+					dynArray1.RemoveRange(7, 0);
+					dynArray2.RemoveRange(7, 0);
+					dynArray1.RemoveRange(5, 2);
+					dynArray2.RemoveRange(5, 2);
+
+					const int expectedResult[5] = { 6, 7, 0, 9, 4 };
+
+					Require(dynArray1.Size() == 5)
+					Require(dynArray2.Size() == 5)
+					Require(CountedItem::alive == 5)
+
+					for (unsigned int i = 0; i < 5; ++i)
+					{
+						Require(dynArray1[i] == expectedResult[i])
+						Require(dynArray2[i].value == expectedResult[i])
+					}
+
+					// Remove everything.
+					dynArray1.RemoveRange(0, 5);
+					dynArray2.RemoveRange(0, 5);
+
+					Require(dynArray1.Size() == 0)
+					Require(dynArray2.Size() == 0)
+				}
+
+				Require(CountedItem::alive == 0)
+			}
+
+			Subtest("RemoveLast()")
+			{
+				{
+					DynamicArray<int> dynArray1;
+					DynamicArray<CountedItem> dynArray2;
+
+					for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					{
+						dynArray1.Append(numbers[i]);
+						dynArray2.EmplaceBack(numbers[i]);
+					}
+
+					// Remove the items from the end, like popping a stack.
+					for (unsigned int i = NUM_COUNT; i > 0; --i)
+					{
+						Require(dynArray1[i - 1] == numbers[i - 1])
+						Require(dynArray2[i - 1].value == numbers[i - 1])
+
+						dynArray1.RemoveLast();
+						dynArray2.RemoveLast();
+
+						Require(dynArray1.Size() == i - 1)
+						Require(CountedItem::alive == static_cast<int>(i - 1))
+					}
+
+					// The capacity is kept for the next items.
+					Require(dynArray1.Capacity() == 16)
+				}
+
+				Require(CountedItem::alive == 0)
+			}
+
+			Subtest("SwapRemove()")
+			{
+				DynamicArray<std::string> dynArray;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					dynArray.Append(std::to_string(numbers[i]));
+
+				// Removing the last item moves nothing, removing any other item moves the last item into its place.
+				Require(dynArray.SwapRemove(NUM_COUNT - 1) == false)
+				Require(dynArray.SwapRemove(0) == true)
+				Require(dynArray.SwapRemove(3) == true)
+				Require(dynArray.Size() == NUM_COUNT - 3)
+
+				const int expectedResult[NUM_COUNT - 3] = { 2, 6, 7, 4, 3, 0, 9 };
+
+				for (unsigned int i = 0; i < NUM_COUNT - 3; ++i)
+					Require(dynArray[i] == std::to_string(expectedResult[i]))
+			}
+
+			Subtest("SwapRemove() with indices")
+			{
+				constexpr unsigned int HANDLE_COUNT = 100;
+
+				// Each item is its own handle. The table stores the index of each handle in the array.
+				DynamicArray<unsigned int> dynArray;
+				unsigned int indexOfHandle[HANDLE_COUNT];
+
+				for (unsigned int i = 0; i < HANDLE_COUNT; ++i)
+				{
+					dynArray.Append(i);
+					indexOfHandle[i] = i;
+				}
+
+				// Remove every third item, including the last item, keeping the table up to date.
+				unsigned int indices[HANDLE_COUNT];
+				unsigned int indexCount = 0;
+
+				for (unsigned int i = 0; i < HANDLE_COUNT; i += 3)
+					indices[indexCount++] = i;
+
+				dynArray.SwapRemove(indices, indexCount, [&](unsigned int, unsigned int _to)
+				{
+					indexOfHandle[dynArray[_to]] = _to;
+				});
+
+				Require(dynArray.Size() == HANDLE_COUNT - indexCount)
+
+				// Every removed handle is gone and every other handle is found through the table.
+				for (unsigned int i = 0; i < HANDLE_COUNT; ++i)
+				{
+					if (i % 3 == 0)
+					{
+						Require(dynArray.Find(i) == false)
+					}
+					else
+					{
+						Require(dynArray[indexOfHandle[i]] == i)
+					}
+				}
+
+				// Remove the rest without a callback.
+				for (unsigned int i = 0; i < dynArray.Size(); ++i)
+					indices[i] = i;
+
+				dynArray.SwapRemove(indices, dynArray.Size());
+				Require(dynArray.Size() == 0)
+			}
+
+			Subtest("IndexOf(), Count(), and Contains()")
+			{
+				DynamicArray<int> dynArray1;
+				DynamicArray<std::string> dynArray2;
+
+				// Fill the arrays with the numbers twice.
+				for (unsigned int i = 0; i < NUM_COUNT * 2; ++i)
+				{
+					dynArray1.Append(numbers[i % NUM_COUNT]);
+					dynArray2.Append(std::to_string(numbers[i % NUM_COUNT]));
+				}
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(dynArray1.IndexOf(numbers[i]) == i)
+					Require(dynArray1.Count(numbers[i]) == 2)
+					Require(dynArray1.Contains(numbers[i]) == true)
+					Require(dynArray2.IndexOf(std::to_string(numbers[i])) == i)
+					Require(dynArray2.Count(std::to_string(numbers[i])) == 2)
+					Require(dynArray2.Contains(std::to_string(numbers[i])) == true)
+				}
+
+				Require(dynArray1.IndexOf(16) == dynArray1.Size())
+				Require(dynArray1.Count(16) == 0)
+				Require(dynArray1.Contains(16) == false)
+				Require(dynArray2.IndexOf("16") == dynArray2.Size())
+			}
+
+			Subtest("Growth policies")
+			{
+				constexpr unsigned int GROWTH_COUNT = 10;
+
+				DynamicArray<int, 0, DoublingGrowth> dynArray1;
+				DynamicArray<int, 0, OneAndHalfGrowth> dynArray2;
+				DynamicArray<int, 0, FixedStepGrowth<5>> dynArray3;
+
+				// Record the capacity every time each array grows.
+				unsigned int capacities1[GROWTH_COUNT] = {};
+				unsigned int capacities2[GROWTH_COUNT] = {};
+				unsigned int capacities3[GROWTH_COUNT] = {};
+				unsigned int growths1 = 0, growths2 = 0, growths3 = 0;
+
+				for (unsigned int i = 0; i < 30; ++i)
+				{
+					dynArray1.Append(i);
+					dynArray2.Append(i);
+					dynArray3.Append(i);
+
+					if (growths1 == 0 || capacities1[growths1 - 1] != dynArray1.Capacity())
+						capacities1[growths1++] = dynArray1.Capacity();
+					if (growths2 == 0 || capacities2[growths2 - 1] != dynArray2.Capacity())
+						capacities2[growths2++] = dynArray2.Capacity();
+					if (growths3 == 0 || capacities3[growths3 - 1] != dynArray3.Capacity())
+						capacities3[growths3++] = dynArray3.Capacity();
+				}
+
+				const unsigned int expectedResult1[GROWTH_COUNT] = { 1, 2, 4, 8, 16, 32 };
+				const unsigned int expectedResult2[GROWTH_COUNT] = { 1, 2, 3, 4, 6, 9, 13, 19, 28, 42 };
+				const unsigned int expectedResult3[GROWTH_COUNT] = { 5, 10, 15, 20, 25, 30 };
+
+				for (unsigned int i = 0; i < GROWTH_COUNT; ++i)
+				{
+					Require(capacities1[i] == expectedResult1[i])
+					Require(capacities2[i] == expectedResult2[i])
+					Require(capacities3[i] == expectedResult3[i])
+				}
+
+				// A range grows the array only once, to a capacity the policy would have reached.
+				const int range[40] = {};
+
+				dynArray1.AppendRange(range, 40);
+				dynArray2.AppendRange(range, 40);
+				dynArray3.AppendRange(range, 40);
+
+				Require(dynArray1.Capacity() == 128)
+				Require(dynArray2.Capacity() == 94)
+				Require(dynArray3.Capacity() == 70)
+
+				for (unsigned int i = 0; i < 30; ++i)
+				{
+					Require(dynArray1[i] == static_cast<int>(i))
+					Require(dynArray2[i] == static_cast<int>(i))
+					Require(dynArray3[i] == static_cast<int>(i))
+				}
+			}
+
+			Subtest("Growth policies near the largest capacity")
+			{
+				constexpr unsigned int MAX_CAPACITY = std::numeric_limits<unsigned int>::max();
+
+				// Growing past the largest unsigned int stops at it instead of wrapping around.
+				Require(DoublingGrowth::NextCapacity(1u << 31, (1u << 31) + 1) == MAX_CAPACITY)
+				Require(DoublingGrowth::NextCapacity(3, (1u << 31) + 1) == 3u << 30)
+				Require(DoublingGrowth::NextCapacity(1u << 30, (1u << 30) + 1) == 1u << 31)
+				Require(DoublingGrowth::NextCapacity(0, MAX_CAPACITY) == MAX_CAPACITY)
+
+				Require(OneAndHalfGrowth::NextCapacity(3000000000u, 3000000001u) == MAX_CAPACITY)
+				Require(OneAndHalfGrowth::NextCapacity(1u << 30, (1u << 30) + 1) == (1u << 30) + (1u << 29))
+				Require(OneAndHalfGrowth::NextCapacity(0, MAX_CAPACITY) == MAX_CAPACITY)
+
+				Require(FixedStepGrowth<5>::NextCapacity(MAX_CAPACITY - 3, MAX_CAPACITY - 2) == MAX_CAPACITY)
+				Require(FixedStepGrowth<1024>::NextCapacity(0, MAX_CAPACITY - 1) == MAX_CAPACITY)
+				Require(FixedStepGrowth<1024>::NextCapacity(0, 1u << 31) == 1u << 31)
+			}
+
+			Subtest("Inline capacity")
+			{
+				constexpr unsigned int INLINE_COUNT = 4;
+
+				DynamicArray<std::string, INLINE_COUNT> dynArray1;
+
+				// The inline buffer holds the first items.
+				Require(dynArray1.Capacity() == INLINE_COUNT)
+
+				for (unsigned int i = 0; i < INLINE_COUNT; ++i)
+					dynArray1.Append(std::to_string(numbers[i]));
+
+				Require(dynArray1.Capacity() == INLINE_COUNT)
+
+				// Moving an array that uses its inline buffer moves the items.
+				DynamicArray<std::string, INLINE_COUNT> dynArray2(std::move(dynArray1));
+
+				Require(dynArray1.Size() == 0)
+				Require(dynArray2.Size() == INLINE_COUNT)
+
+				// Growing past the inline buffer moves the items to the heap.
+				for (unsigned int i = INLINE_COUNT; i < NUM_COUNT; ++i)
+					dynArray2.Append(std::to_string(numbers[i]));
+
+				Require(dynArray2.Capacity() == 16)
+
+				// Moving an array that uses the heap takes the memory, and leaves the inline buffer behind.
+				dynArray1 = std::move(dynArray2);
+
+				Require(dynArray1.Capacity() == 16)
+				Require(dynArray2.Capacity() == INLINE_COUNT)
+
+				DynamicArray<std::string, INLINE_COUNT> dynArray3(dynArray1);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+				{
+					Require(dynArray1[i] == std::to_string(numbers[i]))
+					Require(dynArray3[i] == std::to_string(numbers[i]))
+				}
+
+				// Shrinking to fit the inline buffer moves the items back into it.
+				dynArray1.RemoveRange(2, NUM_COUNT - 2);
+				dynArray1.ShrinkToFit();
+
+				Require(dynArray1.Capacity() == INLINE_COUNT)
+				Require(dynArray1[0] == std::to_string(numbers[0]))
+				Require(dynArray1[1] == std::to_string(numbers[1]))
+
+				// Clearing returns to the inline buffer.
+				dynArray3.Clear();
+
+				Require(dynArray3.Size() == 0)
+				Require(dynArray3.Capacity() == INLINE_COUNT)
+			}
 		}
 	}
 }
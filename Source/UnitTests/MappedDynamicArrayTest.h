@@ -0,0 +1,154 @@
+/*
+	FILE: MappedDynamicArrayTest.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Tests the interface of the MappedDynamicArray and also demonstrates how the data structure can be
+		used. The tests create files in the working directory and delete them when they are done.
+*/
+
+#pragma once
+
+#include <cstdio> // Used for std::remove.
+
+#include "../UnitTests/UnitTest.h"
+#include "../DataStructures/MappedDynamicArray.h"
+
+namespace UT
+{
+	void TestMappedDynamicArray()
+	{
+#if defined(MAPPED_DYNAMIC_ARRAY_SUPPORTED)
+		Test("MappedDynamicArray")
+		{
+			constexpr unsigned int NUM_COUNT = 10;
+			const int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+			const char* path = "MappedDynamicArrayTest.bin";
+
+			Subtest("Open()")
+			{
+				std::remove(path);
+
+				// Opening a file that doesn't exist creates an empty array.
+				MappedDynamicArray<int> mappedArray1(path);
+
+				Require(mappedArray1.IsOpen())
+				Require(mappedArray1.Size() == 0)
+				Require(mappedArray1.Capacity() == 0)
+
+				// A file of a different type is not opened.
+				mappedArray1.Close();
+				MappedDynamicArray<double> mappedArray2;
+
+				Require(mappedArray2.Open(path) == false)
+				Require(mappedArray2.IsOpen() == false)
+
+				std::remove(path);
+			}
+
+			Subtest("Append()")
+			{
+				std::remove(path);
+
+				{
+					MappedDynamicArray<int> mappedArray(path);
+
+					// Fill the array with numbers.
+					for (unsigned int i = 0; i < NUM_COUNT; ++i)
+						mappedArray.Append(numbers[i]);
+
+					mappedArray.AppendRange(numbers, NUM_COUNT);
+
+					Require(mappedArray.Size() == NUM_COUNT * 2)
+					Require(mappedArray.Capacity() == 32)
+				}
+
+				// Reopen the file and check that all numbers are still in the array in the same order.
+				MappedDynamicArray<int> mappedArray(path);
+
+				Require(mappedArray.Size() == NUM_COUNT * 2)
+				Require(mappedArray.Capacity() == 32)
+
+				for (unsigned int i = 0; i < NUM_COUNT * 2; ++i)
+					Require(mappedArray[i] == numbers[i % NUM_COUNT])
+
+				// Change a number, then test that the change is saved.
+				mappedArray[0] = 16;
+				Require(mappedArray.Flush())
+				mappedArray.Close();
+
+				Require(mappedArray.Open(path))
+				Require(mappedArray[0] == 16)
+
+				mappedArray.Close();
+				std::remove(path);
+			}
+
+			Subtest("Reserve() and ShrinkToFit()")
+			{
+				std::remove(path);
+
+				MappedDynamicArray<int> mappedArray(path);
+
+				mappedArray.Reserve(1 << 16);
+				Require(mappedArray.Capacity() == 1 << 16)
+
+				for (unsigned int i = 0; i < (1 << 16); ++i)
+					mappedArray.Append(i);
+
+				// Growing past the reserved capacity keeps the items.
+				mappedArray.Append(16);
+				Require(mappedArray.Capacity() == 1 << 17)
+
+				for (unsigned int i = 0; i < (1 << 16); ++i)
+					Require(mappedArray[i] == static_cast<int>(i))
+
+				mappedArray.ShrinkToFit();
+				Require(mappedArray.Capacity() == (1 << 16) + 1)
+				Require(mappedArray[1 << 16] == 16)
+
+				// Shrinking below the size removes the items that no longer fit.
+				mappedArray.Reserve(NUM_COUNT);
+				Require(mappedArray.Size() == NUM_COUNT)
+
+				mappedArray.RemoveLast();
+				Require(mappedArray.Size() == NUM_COUNT - 1)
+				Require(mappedArray[NUM_COUNT - 2] == NUM_COUNT - 2)
+
+				mappedArray.Clear();
+				Require(mappedArray.Size() == 0)
+				Require(mappedArray.Capacity() == 0)
+
+				mappedArray.Close();
+				std::remove(path);
+			}
+
+			Subtest("AppendRange() of the array's own items")
+			{
+				std::remove(path);
+
+				MappedDynamicArray<int> mappedArray(path);
+
+				for (int i = 0; i < (1 << 16); ++i)
+					mappedArray.Append(i);
+
+				// With no spare capacity, the array grows, and can move, while its own items are appended.
+				mappedArray.ShrinkToFit();
+				mappedArray.AppendRange(&mappedArray[0], mappedArray.Size());
+				mappedArray.AppendRange(&mappedArray[1], 2);
+
+				Require(mappedArray.Size() == (1 << 17) + 2)
+
+				for (int i = 0; i < (1 << 17); ++i)
+					Require(mappedArray[i] == i % (1 << 16))
+
+				Require(mappedArray[1 << 17] == 1)
+				Require(mappedArray[(1 << 17) + 1] == 2)
+
+				mappedArray.Close();
+				std::remove(path);
+			}
+		}
+#endif
+	}
+}
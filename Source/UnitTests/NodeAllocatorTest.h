@@ -0,0 +1,85 @@
+/*
+	FILE: NodeAllocatorTest.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Tests the interface of the node allocators and also demonstrates how they can be used.
+*/
+
+#pragma once
+
+#include "../UnitTests/UnitTest.h"
+#include "../DataStructures/NodeAllocator.h"
+
+namespace UT
+{
+	void TestNodeAllocator()
+	{
+		Test("NodeAllocator")
+		{
+			constexpr unsigned int NUM_COUNT = 10;
+
+			Subtest("HeapAllocator")
+			{
+				HeapAllocator<int> allocator;
+
+				int* items[NUM_COUNT];
+
+				// Allocate, construct, and check each item.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					*(items[i] = allocator.Allocate()) = i;
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(*items[i] == static_cast<int>(i))
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					allocator.Deallocate(items[i]);
+			}
+
+			Subtest("PoolAllocator")
+			{
+				// Use a slab smaller than the number of items, so that more than one slab is needed.
+				PoolAllocator<int> allocator(4);
+
+				int* items[NUM_COUNT];
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					*(items[i] = allocator.Allocate()) = i;
+
+				// Test that no two items share memory.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(*items[i] == static_cast<int>(i))
+
+				// Test that deallocated memory is reused before more memory is allocated.
+				allocator.Deallocate(items[3]);
+				allocator.Deallocate(items[7]);
+
+				Require(allocator.Allocate() == items[7])
+				Require(allocator.Allocate() == items[3])
+			}
+
+			Subtest("ReleaseAll()")
+			{
+				HeapAllocator<int> heapAllocator;
+
+				// The heap allocator can't release items it doesn't track.
+				Require(heapAllocator.ReleaseAll() == false)
+
+				PoolAllocator<int> poolAllocator(4);
+
+				// Try releasing when nothing is allocated.
+				Require(poolAllocator.ReleaseAll() == true)
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					*poolAllocator.Allocate() = i;
+
+				// Release every item at once, then test that the allocator can still be used.
+				Require(poolAllocator.ReleaseAll() == true)
+
+				int* item = poolAllocator.Allocate();
+				*item = 16;
+				Require(*item == 16)
+			}
+		}
+	}
+}
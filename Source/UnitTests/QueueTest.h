@@ -2,7 +2,7 @@
 	FILE: QueueTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: February 1, 2021
-	MODIFIED: February 1, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the interface of the Queue and also demonstrates how the data
 		structure can be used.
 */
@@ -138,6 +138,38 @@ namespace UT
 
 				Require(queue.Peek() == nullptr);
 			}
+
+			Subtest("PoolAllocator")
+			{
+				constexpr unsigned int HALF_COUNT = NUM_COUNT / 2;
+
+				Queue<int, PoolAllocator> queue;
+
+				// Fill the queue, remove half of the numbers, and fill it again so that freed nodes are reused.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					queue.Enqueue(numbers[i]);
+
+				for (unsigned int i = 0; i < HALF_COUNT; ++i)
+					queue.Dequeue();
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					queue.Enqueue(numbers[i]);
+
+				Require(queue.Size() == NUM_COUNT + HALF_COUNT)
+
+				// Check that all numbers are in the queue in order, including in a copy of the queue.
+				const int expectedResult[NUM_COUNT + HALF_COUNT] = { 0, 9, 4, 2, 1, 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+				Queue<int, PoolAllocator> queueCopy(queue);
+
+				unsigned int i = 0;
+				for (Queue<int, PoolAllocator>::Node* iter = queueCopy.Peek(); iter; iter = iter->Next())
+					Require(iter->Data() == expectedResult[i++]);
+
+				Require(i == NUM_COUNT + HALF_COUNT)
+
+				queue.Clear();
+				Require(queue.Size() == 0)
+			}
 		}
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,138 @@
+/*
+	FILE: SearchingTest.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Tests the various searching functions and how they can be used. Every SIMD level the CPU supports
+		is tested, so that each one gives the same results as the scalar search.
+*/
+
+#pragma once
+
+#include <cstdint> // Used for the fixed size integer types.
+#include <limits> // Used for NaN.
+#include <string>
+
+#include "../UnitTests/UnitTest.h"
+#include "../Algorithms/Searching.h"
+
+namespace UT
+{
+	namespace
+	{
+		/*
+			DESCRIPTION: Searches arrays of every length up to the array size, with the value placed at different
+				indices, and checks every SIMD level against the scalar search.
+			PARAMETERS:
+				Type _value, the value to search for.
+				Type _other, a value that is not equal to _value.
+			RETURNS: bool - If every search gave the expected result.
+		*/
+		template<typename Type>
+		bool SearchAllLevels(Type _value, Type _other)
+		{
+			constexpr unsigned int ARRAY_SIZE = 100;
+
+			Type items[ARRAY_SIZE];
+
+			for (unsigned int level = 0; level <= static_cast<unsigned int>(Simd::SupportedLevel()); ++level)
+				for (unsigned int size = 0; size <= ARRAY_SIZE; ++size)
+				{
+					// Place the value at every seventh index from a starting index, or nowhere.
+					for (unsigned int start = 0; start <= size; ++start)
+					{
+						unsigned int expectedCount = 0;
+
+						for (unsigned int i = 0; i < size; ++i)
+						{
+							bool isValue = i >= start && (i - start) % 7 == 0;
+							items[i] = isValue ? _value : _other;
+							expectedCount += isValue ? 1 : 0;
+						}
+
+						Simd::Level simdLevel = static_cast<Simd::Level>(level);
+
+						if (Search::IndexOf(items, size, _value, simdLevel) != start)
+							return false;
+
+						if (Search::Count(items, size, _value, simdLevel) != expectedCount)
+							return false;
+
+						if (Search::Contains(items, size, _value, simdLevel) != (start < size))
+							return false;
+					}
+				}
+
+			return true;
+		}
+	}
+
+	void TestSearching()
+	{
+		Test("Searching")
+		{
+			constexpr unsigned int NUM_COUNT = 10;
+			const int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+			Subtest("IndexOf()")
+			{
+				// Test finding each number.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(Search::IndexOf(numbers, NUM_COUNT, numbers[i]) == i)
+
+				// Test finding a number not in the array.
+				Require(Search::IndexOf(numbers, NUM_COUNT, 16) == NUM_COUNT)
+				Require(Search::IndexOf(numbers, 0, 8) == 0)
+			}
+
+			Subtest("Count()")
+			{
+				const int repeats[NUM_COUNT] = { 1, 2, 1, 3, 1, 2, 1, 3, 1, 2 };
+
+				Require(Search::Count(repeats, NUM_COUNT, 1) == 5)
+				Require(Search::Count(repeats, NUM_COUNT, 2) == 3)
+				Require(Search::Count(repeats, NUM_COUNT, 3) == 2)
+				Require(Search::Count(repeats, NUM_COUNT, 4) == 0)
+			}
+
+			Subtest("Contains()")
+			{
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(Search::Contains(numbers, NUM_COUNT, numbers[i]) == true)
+
+				Require(Search::Contains(numbers, NUM_COUNT, 16) == false)
+			}
+
+			Subtest("SIMD levels")
+			{
+				Require(SearchAllLevels<char>('a', 'b'))
+				Require(SearchAllLevels<std::int8_t>(-1, 1))
+				Require(SearchAllLevels<std::uint16_t>(0xFFFF, 0xFF00))
+				Require(SearchAllLevels<std::int32_t>(-2, 2))
+				Require(SearchAllLevels<std::uint32_t>(0x80000000u, 0x00000080u))
+				Require(SearchAllLevels<std::int64_t>(1, 1ll << 32)) // Only the high halves differ.
+				Require(SearchAllLevels<std::uint64_t>(1ull << 63, 0))
+				Require(SearchAllLevels<float>(1.5f, -1.5f))
+				Require(SearchAllLevels<double>(0.1, 0.2))
+				Require(SearchAllLevels<bool>(true, false))
+				Require(SearchAllLevels<std::string>("found", "other"))
+			}
+
+			Subtest("Floating point equality")
+			{
+				const float nan = std::numeric_limits<float>::quiet_NaN();
+				const float items[NUM_COUNT] = { 1.0f, nan, 2.0f, -0.0f, 3.0f, 4.0f, nan, 5.0f, 0.0f, 6.0f };
+
+				// Zero matches negative zero and NaN matches nothing, the same as operator==.
+				for (unsigned int level = 0; level <= static_cast<unsigned int>(Simd::SupportedLevel()); ++level)
+				{
+					Simd::Level simdLevel = static_cast<Simd::Level>(level);
+
+					Require(Search::IndexOf(items, NUM_COUNT, 0.0f, simdLevel) == 3)
+					Require(Search::Count(items, NUM_COUNT, -0.0f, simdLevel) == 2)
+					Require(Search::Contains(items, NUM_COUNT, nan, simdLevel) == false)
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,90 @@
+/*
+	FILE: SnapshotTest.h
+	AUTHOR: Ozzie Mercado
+	CREATED: October 16, 2026
+	MODIFIED: October 16, 2026
+	DESCRIPTION: Tests the interface of the snapshot reader and writer and also demonstrates how they can be used. The
+		tests create files in the working directory and delete them when they are done.
+*/
+
+#pragma once
+
+#include <cstdio> // Used for std::fopen, std::fputc, std::fclose, and std::remove.
+
+#include "../UnitTests/UnitTest.h"
+#include "../DataStructures/Snapshot.h"
+
+namespace UT
+{
+	void TestSnapshot()
+	{
+		Test("Snapshot")
+		{
+			constexpr unsigned int NUM_COUNT = 10;
+			const int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+			const char* path = "SnapshotTest.bin";
+
+			Subtest("SnapshotWriter and SnapshotReader")
+			{
+				{
+					SnapshotWriter writer(path, sizeof(int), NUM_COUNT);
+
+					for (unsigned int i = 0; i < NUM_COUNT; ++i)
+						writer.Write(&numbers[i], sizeof(int));
+
+					Require(writer.Close())
+				}
+
+				// The items are read back in the order they were written.
+				SnapshotReader reader(path, sizeof(int));
+
+				Require(reader.IsOpen())
+				Require(reader.Count() == NUM_COUNT)
+
+				const int* items = static_cast<const int*>(reader.Items());
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(items[i] == numbers[i])
+
+				// A file of items of a different size is not opened.
+				SnapshotReader doubleReader(path, sizeof(double));
+
+				Require(doubleReader.IsOpen() == false)
+				Require(doubleReader.Count() == 0)
+
+				std::remove(path);
+			}
+
+			Subtest("Invalid files")
+			{
+				// A file that doesn't exist, or that can't be written, is not opened.
+				SnapshotReader missingReader("SnapshotTest.missing", sizeof(int));
+				Require(missingReader.IsOpen() == false)
+
+				SnapshotWriter missingWriter("SnapshotTest.missing/SnapshotTest.bin", sizeof(int), 0);
+				Require(missingWriter.Close() == false)
+
+				// A file with fewer items than its header records is not opened.
+				{
+					SnapshotWriter writer(path, sizeof(int), NUM_COUNT);
+					writer.Write(&numbers[0], sizeof(int));
+					Require(writer.Close())
+				}
+
+				SnapshotReader shortReader(path, sizeof(int));
+				Require(shortReader.IsOpen() == false)
+
+				// A file without a header is not opened.
+				std::FILE* file = std::fopen(path, "wb");
+				for (unsigned int i = 0; i < sizeof(SnapshotHeader) + sizeof(int); ++i)
+					std::fputc('a', file);
+				std::fclose(file);
+
+				SnapshotReader headerlessReader(path, sizeof(int));
+				Require(headerlessReader.IsOpen() == false)
+
+				std::remove(path);
+			}
+		}
+	}
+}
@@ -2,17 +2,206 @@
 	FILE: SortingTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: February 3, 2021
-	MODIFIED: February 4, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the various sorting functions and how they can be used.
 */
 
 #pragma once
 
+#include <atomic> // Used to count items constructed on several threads.
+#include <cmath> // Used for std::signbit, to tell -0.0 from 0.0.
+#include <cstdint> // Used for the fixed size integer types sorted by NetworkSort().
+#include <limits> // Used for std::numeric_limits<float>::infinity.
+#include <new> // Used for placement new, to fill arrays of items without a default constructor.
+#include <string> // Used to sort items that are moved between threads.
+
 #include "../UnitTests/UnitTest.h"
 #include "../Algorithms/Sorting.h"
 
 namespace UT
 {
+	namespace
+	{
+		/*
+			DESCRIPTION: An item without a default constructor, which counts how many are alive. Used to test that 
+				sorts only construct the items they move into their buffers, and destroy all of them.
+		*/
+		struct SortItem
+		{
+			static std::atomic<int> alive; // Number of SortItems constructed and not yet destroyed, on any thread.
+			int key;
+
+			explicit SortItem(int _key) : key(_key) { ++alive; }
+			SortItem(const SortItem& _other) : key(_other.key) { ++alive; }
+			SortItem& operator=(const SortItem& _other) = default;
+			~SortItem() { --alive; }
+		};
+
+		std::atomic<int> SortItem::alive(0);
+
+		/*
+			DESCRIPTION: Sorts an array of SortItems in a scrambled order by their keys.
+			PARAMETERS:
+				SortFunc _sortFunc, sorts the array it is given in ascending order of the keys.
+			RETURNS: bool - If the items were sorted and as many items are alive as before the sort.
+		*/
+		template<typename SortFunc>
+		bool SortItems(SortFunc _sortFunc)
+		{
+			constexpr unsigned int ITEM_COUNT = 1000;
+
+			SortItem* items = static_cast<SortItem*>(::operator new(sizeof(SortItem) * ITEM_COUNT));
+
+			// Multiplying by a number that shares no factor with the count visits every key exactly once.
+			for (unsigned int i = 0; i < ITEM_COUNT; ++i)
+				new (items + i) SortItem((i * 7919) % ITEM_COUNT);
+
+			const int aliveCount = SortItem::alive;
+
+			_sortFunc(items, ITEM_COUNT);
+
+			bool isSorted = SortItem::alive == aliveCount;
+
+			for (unsigned int i = 0; i < ITEM_COUNT; ++i)
+			{
+				isSorted = isSorted && items[i].key == static_cast<int>(i);
+				items[i].~SortItem();
+			}
+
+			::operator delete(items);
+
+			return isSorted;
+		}
+
+		/*
+			DESCRIPTION: The number of times items were copied, moved, and compared during a sort.
+		*/
+		struct SortCounts
+		{
+			unsigned int copies;
+			unsigned int moves;
+			unsigned int comparisons;
+		};
+
+		/*
+			DESCRIPTION: An item that counts every time it is copied or moved.
+		*/
+		struct MoveCountedItem
+		{
+			int value;
+			SortCounts* counts;
+
+			MoveCountedItem(int _value = 0, SortCounts* _counts = nullptr) : value(_value), counts(_counts) {}
+			MoveCountedItem(const MoveCountedItem& _item) : value(_item.value), counts(_item.counts) { ++counts->copies; }
+			MoveCountedItem(MoveCountedItem&& _item) : value(_item.value), counts(_item.counts) { ++counts->moves; }
+
+			MoveCountedItem& operator=(const MoveCountedItem& _item)
+			{
+				value = _item.value;
+				counts = _item.counts;
+				++counts->copies;
+				return *this;
+			}
+
+			MoveCountedItem& operator=(MoveCountedItem&& _item)
+			{
+				value = _item.value;
+				counts = _item.counts;
+				++counts->moves;
+				return *this;
+			}
+		};
+
+		/*
+			DESCRIPTION: Sorts arrays of every length up to NETWORK_SORT_SIZE with NetworkSort() at every SIMD level, 
+				and checks them against InsertionSort().
+			PARAMETERS:
+				Type _low, the lowest value placed in the arrays.
+				Type _high, the highest value placed in the arrays.
+			RETURNS: bool - If every array was sorted.
+		*/
+		template<typename Type>
+		bool NetworkSortAllLevels(Type _low, Type _high)
+		{
+			Type items[Sort::NETWORK_SORT_SIZE];
+			Type expected[Sort::NETWORK_SORT_SIZE];
+			unsigned int seed = 12345;
+
+			for (unsigned int level = 0; level <= static_cast<unsigned int>(Simd::SupportedLevel()); ++level)
+				for (unsigned int size = 0; size <= Sort::NETWORK_SORT_SIZE; ++size)
+				{
+					// Mix in the extremes and some repeated values.
+					for (unsigned int i = 0; i < size; ++i)
+					{
+						seed = seed * 1103515245 + 12345;
+						items[i] = (seed % 5 == 0) ? _low : (seed % 7 == 0) ? _high : static_cast<Type>(static_cast<int>(seed >> 16) % 100 - 50);
+						expected[i] = items[i];
+					}
+
+					Sort::NetworkSort(items, size, static_cast<Simd::Level>(level));
+					Sort::InsertionSort(expected, size);
+
+					for (unsigned int i = 0; i < size; ++i)
+						if (items[i] != expected[i])
+							return false;
+				}
+
+			return true;
+		}
+
+		/*
+			DESCRIPTION: Sorts arrays of -0.0 and 0.0, which compare equal, with NetworkSort() at every SIMD level and 
+				with QuickSort(), and checks that every -0.0 is still in the array afterwards.
+			RETURNS: bool - If the sorts kept both signed zeros.
+		*/
+		template<typename Type>
+		bool SignedZerosKept()
+		{
+			constexpr unsigned int ITEM_COUNT = 4 * Sort::NETWORK_SORT_SIZE;
+			Type items[ITEM_COUNT];
+			unsigned int seed = 12345;
+
+			auto fill = [&](unsigned int _size)
+			{
+				unsigned int negativeCount = 0;
+
+				for (unsigned int i = 0; i < _size; ++i)
+				{
+					seed = seed * 1103515245 + 12345;
+					items[i] = ((seed >> 16) % 2 == 0) ? Type(-0.0) : Type(0.0);
+					negativeCount += std::signbit(items[i]) ? 1 : 0;
+				}
+
+				return negativeCount;
+			};
+
+			auto countNegative = [&](unsigned int _size)
+			{
+				unsigned int negativeCount = 0;
+
+				for (unsigned int i = 0; i < _size; ++i)
+					negativeCount += std::signbit(items[i]) ? 1 : 0;
+
+				return negativeCount;
+			};
+
+			for (unsigned int level = 0; level <= static_cast<unsigned int>(Simd::SupportedLevel()); ++level)
+				for (unsigned int size = 0; size <= Sort::NETWORK_SORT_SIZE; ++size)
+				{
+					const unsigned int negativeCount = fill(size);
+					Sort::NetworkSort(items, size, static_cast<Simd::Level>(level));
+
+					if (countNegative(size) != negativeCount)
+						return false;
+				}
+
+			const unsigned int negativeCount = fill(ITEM_COUNT);
+			Sort::QuickSort(items, ITEM_COUNT);
+
+			return countNegative(ITEM_COUNT) == negativeCount;
+		}
+	}
+
 	void TestSorting()
 	{
 		Test("Sorting")
@@ -92,6 +281,553 @@ namespace UT
 				for (unsigned int i = 1; i < NUM_COUNT; ++i)
 					Require(numbers[i - 1] > numbers[i]);
 			}
+
+			Subtest("BinaryInsertionSort()")
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				// Sort lowest to highest.
+				Sort::BinaryInsertionSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// Sort highest to lowest.
+				Sort::BinaryInsertionSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("BinaryInsertionSortAscending()") // Lowest to highest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::BinaryInsertionSortAscending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+			}
+
+			Subtest("BinaryInsertionSortDescending()") // Highest to lowest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::BinaryInsertionSortDescending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("Insertion sorts move items and are stable")
+			{
+				constexpr unsigned int ITEM_COUNT = 100;
+
+				SortCounts linearCounts = {};
+				SortCounts binaryCounts = {};
+				MoveCountedItem linearItems[ITEM_COUNT];
+				MoveCountedItem binaryItems[ITEM_COUNT];
+
+				// Values from highest to lowest, with each value repeated 4 times. Setting up the items isn't counted.
+				for (unsigned int i = 0; i < ITEM_COUNT; ++i)
+				{
+					linearItems[i].value = binaryItems[i].value = (ITEM_COUNT - 1 - i) / 4 * 1000 + i;
+					linearItems[i].counts = &linearCounts;
+					binaryItems[i].counts = &binaryCounts;
+				}
+
+				// Only the thousands are compared, so the lower digits tell if equal items kept their order.
+				Sort::InsertionSort(linearItems, ITEM_COUNT, [&linearCounts](const MoveCountedItem& _lhs, const MoveCountedItem& _rhs)
+				{
+					++linearCounts.comparisons;
+					return _lhs.value / 1000 > _rhs.value / 1000;
+				});
+
+				Sort::BinaryInsertionSort(binaryItems, ITEM_COUNT, [&binaryCounts](const MoveCountedItem& _lhs, const MoveCountedItem& _rhs)
+				{
+					++binaryCounts.comparisons;
+					return _lhs.value / 1000 > _rhs.value / 1000;
+				});
+
+				for (unsigned int i = 1; i < ITEM_COUNT; ++i)
+				{
+					Require(linearItems[i - 1].value < linearItems[i].value)
+					Require(binaryItems[i - 1].value < binaryItems[i].value)
+				}
+
+				// No item is copied. Each item that is out of place is moved out and back, and each place it passes 
+				// moves one item, 3 times fewer moves than swapping the item into place.
+				const unsigned int passedCount = ITEM_COUNT * (ITEM_COUNT - 4) / 2;
+				const unsigned int outOfPlaceCount = ITEM_COUNT - 4;
+
+				Require(linearCounts.copies == 0)
+				Require(binaryCounts.copies == 0)
+				Require(linearCounts.moves == passedCount + 2 * outOfPlaceCount)
+				Require(binaryCounts.moves == passedCount + 2 * outOfPlaceCount)
+
+				// The binary search takes at most 8 comparisons per item, since there are fewer than 128 items.
+				Require(linearCounts.comparisons >= passedCount)
+				Require(binaryCounts.comparisons <= ITEM_COUNT * 8)
+			}
+
+			Subtest("HeapSort()")
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				// Sort lowest to highest.
+				Sort::HeapSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// Sort highest to lowest.
+				Sort::HeapSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("HeapSortAscending()") // Lowest to highest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::HeapSortAscending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+			}
+
+			Subtest("HeapSortDescending()") // Highest to lowest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::HeapSortDescending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("MergeSort()")
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				// Sort lowest to highest.
+				Sort::MergeSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// Sort highest to lowest.
+				Sort::MergeSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("MergeSortAscending()") // Lowest to highest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::MergeSortAscending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+			}
+
+			Subtest("MergeSortDescending()") // Highest to lowest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::MergeSortDescending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("QuickSort()")
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				// Sort lowest to highest.
+				Sort::QuickSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// Sort highest to lowest.
+				Sort::QuickSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("QuickSortAscending()") // Lowest to highest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::QuickSortAscending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+			}
+
+			Subtest("QuickSortDescending()") // Highest to lowest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::QuickSortDescending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("O(N log N) sorts of large arrays")
+			{
+				constexpr unsigned int LARGE_COUNT = 100000;
+
+				int* numbers = new int[LARGE_COUNT];
+				int* sorted = new int[LARGE_COUNT];
+
+				// Random, sorted, reversed, and few unique items, which are the worst cases for simpler pivots.
+				for (unsigned int pattern = 0; pattern < 4; ++pattern)
+				{
+					for (unsigned int sortIndex = 0; sortIndex < 3; ++sortIndex)
+					{
+						unsigned int seed = 12345;
+
+						for (unsigned int i = 0; i < LARGE_COUNT; ++i)
+						{
+							seed = seed * 1103515245 + 12345;
+
+							if (pattern == 0)
+								numbers[i] = static_cast<int>(seed >> 1);
+							else if (pattern == 1)
+								numbers[i] = i;
+							else if (pattern == 2)
+								numbers[i] = LARGE_COUNT - i;
+							else
+								numbers[i] = (seed >> 16) % 4;
+						}
+
+						if (sortIndex == 0)
+							Sort::HeapSort(numbers, LARGE_COUNT);
+						else if (sortIndex == 1)
+							Sort::MergeSort(numbers, LARGE_COUNT);
+						else
+							Sort::QuickSort(numbers, LARGE_COUNT);
+
+						bool isSorted = true;
+
+						for (unsigned int i = 1; i < LARGE_COUNT; ++i)
+							isSorted = isSorted && numbers[i - 1] <= numbers[i];
+
+						Require(isSorted)
+
+						// Every sort gives the same items.
+						if (sortIndex == 0)
+						{
+							for (unsigned int i = 0; i < LARGE_COUNT; ++i)
+								sorted[i] = numbers[i];
+						}
+						else
+						{
+							bool isSame = true;
+
+							for (unsigned int i = 0; i < LARGE_COUNT; ++i)
+								isSame = isSame && numbers[i] == sorted[i];
+
+							Require(isSame)
+						}
+					}
+				}
+
+				delete[] numbers;
+				delete[] sorted;
+			}
+
+			Subtest("MergeSort() is stable")
+			{
+				// Sort by the tens digit only. Items with the same tens digit must keep their order.
+				constexpr unsigned int STABLE_COUNT = 200;
+				int numbers[STABLE_COUNT];
+
+				for (unsigned int i = 0; i < STABLE_COUNT; ++i)
+					numbers[i] = ((i * 7) % 10) * 10 + i / 20;
+
+				Sort::MergeSort(numbers, STABLE_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs / 10 > _rhs / 10; });
+
+				for (unsigned int i = 1; i < STABLE_COUNT; ++i)
+				{
+					Require(numbers[i - 1] / 10 <= numbers[i] / 10)
+
+					if (numbers[i - 1] / 10 == numbers[i] / 10)
+						Require(numbers[i - 1] % 10 <= numbers[i] % 10)
+				}
+			}
+
+			Subtest("Sorts don't need a default constructor")
+			{
+				Require(SortItems([](SortItem* _items, unsigned int _count)
+				{
+					Sort::MergeSort(_items, _count, [](const SortItem& _lhs, const SortItem& _rhs) { return _lhs.key > _rhs.key; });
+				}))
+
+				// Several threads with a few items each, so that every merge round runs.
+				Require(SortItems([](SortItem* _items, unsigned int _count)
+				{
+					Sort::ParallelSort(_items, _count, [](const SortItem& _lhs, const SortItem& _rhs) { return _lhs.key > _rhs.key; }, 5, 10);
+				}))
+
+				Require(SortItems([](SortItem* _items, unsigned int _count)
+				{
+					Sort::RadixSort(_items, _count, [](const SortItem& _item) { return _item.key; });
+				}))
+			}
+
+			Subtest("ParallelSort()")
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				// Sort lowest to highest.
+				Sort::ParallelSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs > _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// Sort highest to lowest.
+				Sort::ParallelSort<int>(numbers, NUM_COUNT, [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; });
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("ParallelSortAscending()") // Lowest to highest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::ParallelSortAscending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+			}
+
+			Subtest("ParallelSortDescending()") // Highest to lowest.
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::ParallelSortDescending<int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("ParallelSort() of large arrays")
+			{
+				constexpr unsigned int LARGE_COUNT = 100000;
+
+				int* numbers = new int[LARGE_COUNT];
+
+				// A low threshold splits the array between every number of threads, including counts that leave a part 
+				// without a pair to merge with.
+				for (unsigned int threadCount = 1; threadCount <= 9; ++threadCount)
+				{
+					unsigned int seed = threadCount;
+
+					for (unsigned int i = 0; i < LARGE_COUNT; ++i)
+					{
+						seed = seed * 1103515245 + 12345;
+						numbers[i] = static_cast<int>(seed >> 1) % 1000;
+					}
+
+					Sort::ParallelSort(numbers, LARGE_COUNT, std::greater<int>(), threadCount, 1000);
+
+					bool isSorted = true;
+
+					for (unsigned int i = 1; i < LARGE_COUNT; ++i)
+						isSorted = isSorted && numbers[i - 1] <= numbers[i];
+
+					Require(isSorted)
+				}
+
+				// Sort highest to lowest, on more threads than the threshold allows.
+				Sort::ParallelSort(numbers, LARGE_COUNT, std::less<int>(), 64, LARGE_COUNT / 4);
+
+				bool isSorted = true;
+
+				for (unsigned int i = 1; i < LARGE_COUNT; ++i)
+					isSorted = isSorted && numbers[i - 1] >= numbers[i];
+
+				Require(isSorted)
+
+				delete[] numbers;
+			}
+
+			Subtest("ParallelSort() keeps every item")
+			{
+				// Strings are moved, not copied, between the array and the buffer.
+				constexpr unsigned int WORD_COUNT = 5000;
+				std::string* words = new std::string[WORD_COUNT];
+
+				for (unsigned int i = 0; i < WORD_COUNT; ++i)
+					words[i] = std::to_string((i * 7919) % WORD_COUNT) + " is a number long enough to be on the heap";
+
+				Sort::ParallelSort(words, WORD_COUNT, std::greater<std::string>(), 4, 100);
+
+				for (unsigned int i = 1; i < WORD_COUNT; ++i)
+					Require(words[i - 1] < words[i])
+
+				delete[] words;
+			}
+
+			Subtest("RadixSort()")
+			{
+				int numbers[NUM_COUNT] = { 8, -6, 7, 5, -3, 0, 9, -4, 2, 1 };
+
+				Sort::RadixSort(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// Negative floating point numbers, zero, and infinity are ordered by value.
+				const float infinity = std::numeric_limits<float>::infinity();
+				float decimals[NUM_COUNT] = { 8.5f, -6.25f, 7.0f, -infinity, -3.0f, 0.0f, infinity, -4.75f, 0.125f, -0.5f };
+
+				Sort::RadixSort(decimals, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(decimals[i - 1] < decimals[i]);
+			}
+
+			Subtest("RadixSortAscending()") // Lowest to highest.
+			{
+				double numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::RadixSortAscending<double>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+			}
+
+			Subtest("RadixSortDescending()") // Highest to lowest.
+			{
+				unsigned int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				Sort::RadixSortDescending<unsigned int>(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
+
+			Subtest("RadixSort() of large arrays")
+			{
+				constexpr unsigned int LARGE_COUNT = 100000;
+
+				long long* numbers = new long long[LARGE_COUNT];
+				double* decimals = new double[LARGE_COUNT];
+				unsigned int seed = 12345;
+
+				// Numbers across the whole range of each type, with the extremes included.
+				for (unsigned int i = 0; i < LARGE_COUNT; ++i)
+				{
+					seed = seed * 1103515245 + 12345;
+					numbers[i] = (static_cast<long long>(seed) << 32) ^ (seed * 2654435761u);
+					decimals[i] = static_cast<double>(numbers[i]) / (1 + (seed >> 20));
+				}
+
+				numbers[0] = static_cast<long long>(1ull << 63);
+				numbers[1] = static_cast<long long>(~(1ull << 63));
+
+				Sort::RadixSort(numbers, LARGE_COUNT);
+				Sort::RadixSortDescending(decimals, LARGE_COUNT);
+
+				bool isSorted = true;
+
+				for (unsigned int i = 1; i < LARGE_COUNT; ++i)
+					isSorted = isSorted && numbers[i - 1] <= numbers[i] && decimals[i - 1] >= decimals[i];
+
+				Require(isSorted)
+				Require(numbers[0] == static_cast<long long>(1ull << 63))
+				Require(numbers[LARGE_COUNT - 1] == static_cast<long long>(~(1ull << 63)))
+
+				delete[] numbers;
+				delete[] decimals;
+			}
+
+			Subtest("RadixSort() by key")
+			{
+				struct Record
+				{
+					short key;
+					unsigned int order;
+				};
+
+				// Sort records by a small key. Records with the same key must keep their order.
+				constexpr unsigned int RECORD_COUNT = 1000;
+				Record* records = new Record[RECORD_COUNT];
+
+				for (unsigned int i = 0; i < RECORD_COUNT; ++i)
+					records[i] = Record{ static_cast<short>((i * 37) % 21 - 10), i };
+
+				Sort::RadixSort(records, RECORD_COUNT, [](const Record& _record) { return _record.key; });
+
+				for (unsigned int i = 1; i < RECORD_COUNT; ++i)
+				{
+					Require(records[i - 1].key <= records[i].key)
+
+					if (records[i - 1].key == records[i].key)
+						Require(records[i - 1].order < records[i].order)
+				}
+
+				Require(records[0].key == -10)
+
+				delete[] records;
+			}
+
+			Subtest("NetworkSort()")
+			{
+				Require(NetworkSortAllLevels<int32_t>(std::numeric_limits<int32_t>::lowest(), std::numeric_limits<int32_t>::max()))
+				Require(NetworkSortAllLevels<int64_t>(std::numeric_limits<int64_t>::lowest(), std::numeric_limits<int64_t>::max()))
+				Require(NetworkSortAllLevels<float>(-std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()))
+				Require(NetworkSortAllLevels<double>(std::numeric_limits<double>::lowest(), std::numeric_limits<double>::infinity()))
+
+				// Types without a network are sorted too.
+				Require(NetworkSortAllLevels<short>(-1000, 1000))
+
+				// -0.0 and 0.0 are equal, but sorting them must not turn one into the other.
+				Require(SignedZerosKept<float>())
+				Require(SignedZerosKept<double>())
+
+				// An array with a NaN is sorted the same way as InsertionSort() sorts it, keeping every item.
+				float decimals[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, std::numeric_limits<float>::quiet_NaN(), 2, 1 };
+				float expected[NUM_COUNT];
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					expected[i] = decimals[i];
+
+				Sort::NetworkSort(decimals, NUM_COUNT);
+				Sort::InsertionSort(expected, NUM_COUNT);
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					Require(decimals[i] == expected[i] || (decimals[i] != decimals[i] && expected[i] != expected[i]))
+			}
+
+			Subtest("Compare")
+			{
+				int numbers[NUM_COUNT] = { 8, 6, 7, 5, 3, 0, 9, 4, 2, 1 };
+
+				// Without a comparison function, items are sorted lowest to highest.
+				Sort::InsertionSort(numbers, NUM_COUNT);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] < numbers[i]);
+
+				// A std::function can still be passed in where a lambda's type cannot be named.
+				std::function<bool(const int&, const int&)> isLesser = [](const int& _lhs, const int& _rhs) { return _lhs < _rhs; };
+				Sort::BubbleSort(numbers, NUM_COUNT, isLesser);
+
+				for (unsigned int i = 1; i < NUM_COUNT; ++i)
+					Require(numbers[i - 1] > numbers[i]);
+			}
 		}
 	}
 }
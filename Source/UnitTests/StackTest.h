@@ -2,7 +2,7 @@
 	FILE: StackTest.h
 	AUTHOR: Ozzie Mercado
 	CREATED: January 31, 2021
-	MODIFIED: January 31, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: Tests the interface of the Stack and also demonstrates how the data
 		structure can be used.
 */
@@ -138,6 +138,38 @@ namespace UT
 
 				Require(stack.Peek() == nullptr);
 			}
+
+			Subtest("PoolAllocator")
+			{
+				constexpr unsigned int HALF_COUNT = NUM_COUNT / 2;
+
+				Stack<int, PoolAllocator> stack;
+
+				// Fill the stack, remove half of the numbers, and fill it again so that freed nodes are reused.
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					stack.Push(numbers[i]);
+
+				for (unsigned int i = 0; i < HALF_COUNT; ++i)
+					stack.Pop();
+
+				for (unsigned int i = 0; i < NUM_COUNT; ++i)
+					stack.Push(numbers[i]);
+
+				Require(stack.Size() == NUM_COUNT + HALF_COUNT)
+
+				// Check that all numbers are in the stack in the expected order, including in a copy of the stack.
+				const int expectedResult[NUM_COUNT + HALF_COUNT] = { 1, 2, 4, 9, 0, 3, 5, 7, 6, 8, 3, 5, 7, 6, 8 };
+				Stack<int, PoolAllocator> stackCopy(stack);
+
+				unsigned int i = 0;
+				for (Stack<int, PoolAllocator>::Node* iter = stackCopy.Peek(); iter; iter = iter->Next())
+					Require(iter->Data() == expectedResult[i++]);
+
+				Require(i == NUM_COUNT + HALF_COUNT)
+
+				stack.Clear();
+				Require(stack.Size() == 0)
+			}
 		}
 	}
-}
\ No newline at end of file
+}
@@ -2,22 +2,27 @@
 	FILE: main.cpp
 	AUTHOR: Ozzie Mercado
 	CREATED: January 26, 2021
-	MODIFIED: February 1, 2021
+	MODIFIED: October 16, 2026
 	DESCRIPTION: This is the entry point for the unit testing of all data structures developed.
 */
 
 #include "UnitTests/UnitTest.h"
 
 // Data structure test includes.
+#include "UnitTests/ArrayAllocatorTest.h"
 #include "UnitTests/AVLTreeTest.h"
 #include "UnitTests/BinarySearchTreeTest.h"
 #include "UnitTests/DoublyLinkedListTest.h"
 #include "UnitTests/DynamicArrayTest.h"
+#include "UnitTests/MappedDynamicArrayTest.h"
+#include "UnitTests/NodeAllocatorTest.h"
 #include "UnitTests/SinglyLinkedListTest.h"
+#include "UnitTests/SnapshotTest.h"
 #include "UnitTests/StackTest.h"
 #include "UnitTests/QueueTest.h"
 
 // Algorithm test includes.
+#include "UnitTests/SearchingTest.h"
 #include "UnitTests/SortingTest.h"
 
 /*
@@ -30,15 +35,20 @@ int main(int _argCount, char** _argVals)
 	UT::Start();
 
 	// Test Data Structures.
+	UT::TestArrayAllocator();
 	UT::TestAVLTree();
 	UT::TestBinarySearchTree();
 	UT::TestDoublyLinkedList();
 	UT::TestDynamicArray();
+	UT::TestMappedDynamicArray();
+	UT::TestNodeAllocator();
 	UT::TestSinglyLinkedList();
+	UT::TestSnapshot();
 	UT::TestStack();
 	UT::TestQueue();
 
 	// Test Algorithms.
+	UT::TestSearching();
 	UT::TestSorting();
 
 	UT::End();